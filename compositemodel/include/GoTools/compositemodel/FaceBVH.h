@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _FACEBVH_H
+#define _FACEBVH_H
+
+#include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include <vector>
+
+namespace Go
+{
+
+class ftSurface;
+
+/// Used internally in SurfaceModel. A bounding volume hierarchy over the
+/// faces of a surface model. Large faces are represented by the boxes of
+/// a number of parameter sub-domains, giving tighter bounds than one box
+/// for the entire face. Closest point queries traverse the hierarchy
+/// best-first and skip all nodes further away than the currently best
+/// point. The hierarchy keeps the surfaces of the faces. Evaluation may
+/// update cached information in a surface, so concurrent queries must
+/// use the overload of closestPoint that evaluates thread local copies.
+class FaceBVH
+{
+ public:
+  /// Empty hierarchy
+  FaceBVH();
+
+  /// Build hierarchy
+  /// \param faces Faces of the model. The position in the vector is the
+  /// face index reported by closestPoint
+  /// \param split_fac A face is divided into sub-patches as long as the
+  /// diagonal of the sub-patch box is larger than split_fac times the
+  /// diagonal of the model box
+  /// \param max_level Maximum number of recursive 2x2 subdivisions of
+  /// a face
+  /// The surfaces of the faces are stored and set to use geometric
+  /// iteration in closest point computations
+  FaceBVH(const std::vector<ftSurface*>& faces, double split_fac = 0.1,
+	  int max_level = 3);
+
+  /// Destructor
+  ~FaceBVH();
+
+  /// Number of faces
+  int nmbFaces() const
+  {
+    return nmb_faces_;
+  }
+
+  /// Number of leaf entries (faces and sub-patches)
+  int nmbEntries() const
+  {
+    return (int)entries_.size();
+  }
+
+  /// Box surrounding all faces
+  const BoundingBox& big_box() const
+  {
+    return big_box_;
+  }
+
+  /// Closest point between a point and the faces in the hierarchy.
+  /// The surfaces of the faces are evaluated, thus concurrent calls
+  /// are not allowed
+  /// \param pt Input point
+  /// \param epsilon Tolerance for the closest point iteration
+  /// \param checked Workspace. Must have size equal to the number of
+  /// faces and all entries false. Is returned in the same state
+  /// \param clo_u Parameter value of the closest point
+  /// \param clo_v Parameter value of the closest point
+  /// \param clo_pt Closest point
+  /// \param clo_dist Distance between the input point and the closest point
+  /// \param nmb_tested If not null, returns the number of faces for which
+  /// the closest point was computed
+  /// \return Index of the face containing the closest point, -1 if the
+  /// hierarchy is empty
+  int closestPoint(const Point& pt, double epsilon,
+		   std::vector<bool>& checked,
+		   double& clo_u, double& clo_v, Point& clo_pt,
+		   double& clo_dist, int *nmb_tested = 0) const;
+
+  /// Closest point as above, evaluating copies of the surfaces owned by
+  /// the caller. A surface is copied the first time the traversal reaches
+  /// its face, so only faces close to the query points are copied.
+  /// Several threads may query the hierarchy concurrently, each with its
+  /// own copies
+  /// \param copies The copies, one entry for each face. Entries are null
+  /// for faces not reached by any query so far
+  int closestPoint(const Point& pt,
+		   std::vector<shared_ptr<ParamSurface> >& copies,
+		   double epsilon, std::vector<bool>& checked,
+		   double& clo_u, double& clo_v, Point& clo_pt,
+		   double& clo_dist, int *nmb_tested = 0) const;
+
+ private:
+  // Leaf entry. A face or a sub-patch of a face
+  struct Entry
+  {
+    int face_;
+    BoundingBox box_;
+    Point mid_;
+  };
+
+  // Tree node. Internal nodes refer to two children, leaf nodes to a
+  // range of entries
+  struct Node
+  {
+    BoundingBox box_;
+    int child_[2];
+    int first_;
+    int nmb_;
+  };
+
+  int nmb_faces_;
+  std::vector<shared_ptr<ParamSurface> > surfs_;
+  BoundingBox big_box_;
+  std::vector<Entry> entries_;
+  std::vector<Node> nodes_;
+
+  void addFaceEntries(int face_idx, ftSurface* face, double split_lim,
+		      int max_level);
+
+  void addSubPatches(int face_idx, const ParamSurface& surf,
+		     const BoundingBox& face_box, const RectDomain& dom,
+		     double split_lim, int level, int max_level,
+		     std::vector<Entry>& sub);
+
+  int buildNode(int first, int nmb);
+
+  int closest(const Point& pt,
+	      std::vector<shared_ptr<ParamSurface> >* copies,
+	      double epsilon, std::vector<bool>& checked,
+	      double& clo_u, double& clo_v, Point& clo_pt,
+	      double& clo_dist, int *nmb_tested) const;
+};
+
+} // namespace Go
+
+#endif // _FACEBVH_H
@@ -62,6 +62,12 @@ class PointOnEdge
   /// \param par associated edge parameter
   PointOnEdge(ftEdge* edge, double par);
 
+  /// Constructor with an already computed position
+  /// \param the edge on which the point lies
+  /// \param par associated edge parameter
+  /// \param pt position of the edge at par
+  PointOnEdge(ftEdge* edge, double par, const Point& pt);
+
   /// Destructor
   ~PointOnEdge();
 	
@@ -44,6 +44,7 @@
 #include "GoTools/compositemodel/ftSurface.h"
 #include "GoTools/compositemodel/ftFaceBase.h"
 #include "GoTools/compositemodel/CellDivision.h"
+#include "GoTools/compositemodel/FaceBVH.h"
 //#include "GoTools/topology/tpTopologyTable.h"
 #include "GoTools/compositemodel/ftCurve.h"
 #include "GoTools/compositemodel/ftPoint.h"
@@ -57,6 +58,7 @@
 #include "GoTools/compositemodel/ftLine.h"
 #include "GoTools/compositemodel/FaceUtilities.h"
 #include <vector>
+#include <map>
 
 namespace Go
 {
@@ -69,6 +71,7 @@ namespace Go
  class IntResultsSfModel;
  class Loop;
  class Body;
+ class GenericTriMesh;
  struct SamplePointData;
 
 //===========================================================================
@@ -309,6 +312,20 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Closest point
   ftPoint closestPoint(const ftPoint& point) { return closestPoint(point.position()); }
 
+  /// Closest point between each of a set of points and this surface model.
+  /// The points are distributed between threads if OpenMP is enabled.
+  /// \param pnts Input points
+  /// \param clo_pnts Found closest points
+  /// \param idx Index of surface where the closest points are found
+  /// \param clo_par Parameter values corresponding to the closest points,
+  /// two entries for each point
+  /// \param dist Distance between input points and found closest points
+  void closestPoints(const std::vector<Point>& pnts,
+		     std::vector<Point>& clo_pnts,
+		     std::vector<int>& idx,
+		     std::vector<double>& clo_par,
+		     std::vector<double>& dist);
+
 
   /// Extremal point(s) in a given direction
   /// Note that the found extremal point may be less accurate for trimmed surfaces
@@ -635,6 +652,49 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all surfaces with respect to a given tesselation density
+  /// and merge the face meshes into one indexed triangle mesh. Boundary
+  /// nodes of adjacent faces that coincide within the gap tolerance are
+  /// shared. The faces are sampled independently, so adjacent faces
+  /// in general have different nodes along their common boundary, and
+  /// the merged mesh is not watertight. Use tesselateAdaptiveMerged() to get face meshes
+  /// that share the nodes along common edges
+  /// \param density Tesselation density
+  /// \return Merged triangle mesh without normals. Nodes flagged as
+  /// boundary nodes are not shared with any other face
+  shared_ptr<GenericTriMesh> tesselateMerged(double density) const;
+
+  /// Tesselate all surfaces with respect to given resolutions in each
+  /// parameter direction and merge the face meshes as above. The merged
+  /// mesh is not watertight in general
+  /// \param resolution[] Tesselation resolution
+  /// \return Merged triangle mesh
+  shared_ptr<GenericTriMesh> tesselateMerged(int resolution[]) const;
+
+  /// Tesselate all surfaces adaptively with respect to a chordal
+  /// tolerance and an angular tolerance. The triangles are small where
+  /// the surfaces are curved and large where they are flat. Each edge 
+  /// is sampled once, and the same points are used in the meshes of
+  /// both adjacent faces. Thus, the face meshes fit together along 
+  /// common boundaries
+  /// \param chord_tol Maximum distance between the triangles and the 
+  /// surfaces
+  /// \param ang_tol Maximum angle (radians) between surface normals
+  /// at the nodes of a triangle
+  /// \retval meshes One triangle mesh for each face that could be
+  /// tesselated
+  void tesselateAdaptive(double chord_tol, double ang_tol,
+			 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
+
+  /// Tesselate all surfaces adaptively as above and merge the face 
+  /// meshes into one indexed triangle mesh
+  /// \param chord_tol Maximum distance between the triangles and the 
+  /// surfaces
+  /// \param ang_tol Maximum angle (radians) between surface normals
+  /// \return Merged triangle mesh
+  shared_ptr<GenericTriMesh> tesselateAdaptiveMerged(double chord_tol,
+						     double ang_tol) const;
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -729,6 +789,13 @@ class GO_API SurfaceModel : public CompositeModel
   void getOverlappingFaces(double tol,
 			   std::vector<std::pair<ftSurface*, ftSurface*> >& faces);
 
+  /// Return the indices of pairs of overlapping faces. The first index
+  /// of each pair is smaller than the second one
+  /// \param tol Overlap tolerance
+  /// \retval face_idx Vector of pairs of indices of overlapping faces
+  void getOverlappingFaces(double tol,
+			   std::vector<std::pair<int, int> >& face_idx);
+
   /// Return all vertices associated with this surface model
   /// \retval vertices Vector of pointers to all vertices.
   void getAllVertices(std::vector<shared_ptr<Vertex> >& vertices) const;
@@ -887,6 +954,7 @@ class GO_API SurfaceModel : public CompositeModel
   std::vector<std::vector<shared_ptr<Loop> > > boundary_curves_;
 
   shared_ptr<CellDivision> celldiv_ ;   // To gain speedup in closest point and intersections
+  shared_ptr<FaceBVH> face_bvh_;  // Bounding volume hierarchy for closest point, built on demand
   mutable std::vector<bool> face_checked_;
   //  mutable BoundingBox big_box_;
   BoundingBox limit_box_;
@@ -913,12 +981,28 @@ class GO_API SurfaceModel : public CompositeModel
 		      std::vector<std::pair<double,double> >& crv_bound,
 		      bool compute_curves=true) const;
 
-  ftPoint closestPointLocal(const ftPoint& point) const;
+  void initializeFaceBVH();
 
   void localExtreme(ftSurface *face, Point& dir, 
 		    Point& ext_pnt, int& ext_id,
 		    double ext_par[]);
 
+  // Tesselate faces in parallel with the resolutions res[2*ki], 
+  // res[2*ki+1] for face number ki. Faces that cannot be tesselated
+  // are skipped
+  void tesselateFaces(const std::vector<shared_ptr<ftFaceBase> >& faces,
+		      const std::vector<int>& res,
+		      std::vector<shared_ptr<GeneralMesh> >& meshes) const;
+
+  // Sample an edge with respect to the tolerances for adaptive
+  // tesselation. The parameters are returned in the direction of the
+  // edge in its loop. If the twin edge is sampled already, the points
+  // of the twin are reused. The positions of sampled edges are stored
+  // in edge_pnts
+  void sampleEdge(ftEdge* edge, double chord_tol, double ang_tol,
+		  std::map<ftEdge*, std::vector<Point> >& edge_pnts,
+		  std::vector<double>& tpar, std::vector<Point>& pnts) const;
+
   void meshToTriang(shared_ptr<ftSurface> face,
 		    shared_ptr<GeneralMesh> mesh,
 		    int n, int m, shared_ptr<ftPointSet> triang,
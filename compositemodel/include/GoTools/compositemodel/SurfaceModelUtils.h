@@ -57,6 +57,7 @@ namespace Go
   class BoundedSurface;
   class CurveOnSurface;
   class ftPointSet;
+  class GenericTriMesh;
 
   namespace SurfaceModelUtils
   {
@@ -145,6 +146,30 @@ namespace Go
 			 shared_ptr<GeneralMesh>& mesh,
 			 double tol2d, int n=20, int m=20);
 
+    /// Check if a parallel loop over nmb_tasks faces runs on more than
+    /// one thread, in which case the surfaces must be accessed through
+    /// threadSafeSurface()
+    bool needSurfaceCopies(int nmb_tasks);
+
+    /// Surface to evaluate in a parallel loop over faces. Faces may share
+    /// underlying surfaces, and evaluation updates cached information
+    /// in the surface, so a thread must not evaluate a surface that other
+    /// threads may evaluate at the same time. With clone set, a copy owned
+    /// by the calling thread is returned. The original is only read
+    /// \param surf The surface of a face
+    /// \param clone Whether to copy the surface, see needSurfaceCopies()
+    /// \return A copy of surf if clone is set, otherwise surf
+    shared_ptr<ParamSurface> threadSafeSurface(shared_ptr<ParamSurface> surf,
+					       bool clone);
+
+    /// Merge a set of meshes into one indexed triangle mesh. Boundary
+    /// nodes that coincide within the tolerance are represented once
+    /// in the merged mesh, and triangles collapsed by the merge are
+    /// removed. A node is flagged as a boundary node if it is a
+    /// boundary node in its mesh and it is not merged with any other node
+    void mergeMeshes(const std::vector<shared_ptr<GeneralMesh> >& meshes,
+		     double tol, shared_ptr<GenericTriMesh>& merged);
+
     void triangulateFaces(std::vector<shared_ptr<ftSurface> >& faces,
 			  shared_ptr<ftPointSet>& triang, double tol);
 
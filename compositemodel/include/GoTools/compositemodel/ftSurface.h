@@ -282,9 +282,12 @@ public:
       getBoundaryPiece(Point& pt1, Point& pt2, double eps);
 
 
-    /// Check for constant parameter line kinks
+    /// Check for constant parameter line kinks. If copy_geometry is set,
+    /// a copy of the surface is evaluated, and the function may be called
+    /// for several faces in parallel
     bool getSurfaceKinks(double angtol, std::vector<double>& g1_disc_u,
-			 std::vector<double>& g1_disc_v);
+			 std::vector<double>& g1_disc_v,
+			 bool copy_geometry = false);
 
     /// Check for constant parameter line kinks, i.e. C1 discontinuities
     bool getSurfaceDisconts(double tol, std::vector<double>& disc_u,
@@ -354,9 +357,11 @@ public:
     /// Check if this face is connected to a given vertex
     bool hasVertex(Vertex *vx) const;
 
-    /// Collect all pairs of surface and vertex points where distance is greater than a tolerance
+    /// Collect all pairs of surface and vertex points where distance is greater than a tolerance.
+    /// If copy_geometry is set, a copy of the surface is evaluated, and the
+    /// function may be called for several faces in parallel
     void getBadDistance(std::vector<std::pair<ftSurface*, shared_ptr<Vertex> > >& badPairs,
-			double tol);
+			double tol, bool copy_geometry = false);
 
     /// Collect all pairs of surface and edge where some part of the 
     /// edge has a distance to the surface greater than a tolerance
@@ -381,10 +386,13 @@ public:
     /// Used in quality checing of a surface model
     bool hasAcuteAngle(ftEdge* along_edge, double angtol) const;
 
-    ///  Get pairs of close boundary loop points
+    ///  Get pairs of close boundary loop points. If copy_geometry is set,
+    ///  copies of the surface and the edge curves are evaluated, and the
+    ///  function may be called for several faces in parallel
     void getNarrowRegion(double gap_tol, double tol, 
 			 std::vector<std::pair<shared_ptr<PointOnEdge>, 
-			 shared_ptr<PointOnEdge> > >& narrow_pt);
+			 shared_ptr<PointOnEdge> > >& narrow_pt,
+			 bool copy_geometry = false);
 
     /// Check and fix orientation of boundary loops of trimmed surfaces
     /// \return \c true if the orientation of a boundary loop was
@@ -62,6 +62,7 @@
 
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/creators/ConstraintDefinitions.h"
+#include "GoTools/creators/SparseMatrix.h"
 
 #include <vector>
 
@@ -214,7 +215,7 @@ protected:
     std::vector<double>::iterator scoef_;   // Pointer to surface coefficients.      
 
     /// Storage of the equation system.
-    std::vector<double> gmat_;         // Matrix at left side of equation system.  
+    SparseMatrix gmat_;                // Matrix at left side of equation system.  
     std::vector<double> gright_;       // Right side of equation system.      
 
     ///   Free all memory allocated for class members.
@@ -58,12 +58,24 @@
 namespace Go
 {
 
+class SparseMatrix;
+
 /// Solve the equation system Ax=b where A is a symmetric
 /// positive definite matrix using the Conjugate Gradient Method.
 class SolveCG
 {
 public:
 
+    /// Available preconditioners.
+    enum Preconditioner
+    {
+	PRECOND_NONE = 0,   ///< No preconditioning
+	PRECOND_RILU,       ///< Relaxed incomplete LU factorization
+	PRECOND_JACOBI,     ///< Diagonal scaling
+	PRECOND_SSOR,       ///< Symmetric successive over-relaxation
+	PRECOND_IC          ///< Incomplete Cholesky factorization
+    };
+
     /// Default constructor.
     SolveCG();
 
@@ -79,10 +91,38 @@ public:
     /// \param nn the number of unknowns in the system.
     void attachMatrix(double *gmat, int nn);
 
+    /// Attach the left side of the equation system given as a sparse
+    /// matrix. The compressed row representation is taken directly from
+    /// the matrix, thus the storage and the computation time depend on
+    /// the number of non-zero entries only.
+    /// \param mat the system matrix for the linear equations.
+    void attachMatrix(const SparseMatrix& mat);
+
     /// Prepare for preconditioning.
     /// \param relaxfac relaxation parameter. Range: [0,0, 1.0].
     virtual void precondRILU(double relaxfac);
 
+    /// Prepare for diagonal (Jacobi) preconditioning. Cheap to set up
+    /// and apply, and the application is parallel when OpenMP is enabled.
+    void precondJacobi();
+
+    /// Prepare for symmetric successive over-relaxation preconditioning.
+    /// No factorization is needed, the preconditioner is applied directly
+    /// on the system matrix.
+    /// \param relaxfac relaxation parameter. Range: <0.0, 2.0>.
+    void precondSSOR(double relaxfac);
+
+    /// Prepare for incomplete Cholesky preconditioning with the sparsity
+    /// pattern of the system matrix, IC(0). The factorization is computed
+    /// in the form LDL^T. If a non-positive pivot occurs, the diagonal
+    /// of the matrix is scaled up and the factorization is restarted.
+    void precondIC();
+
+    /// Select and prepare a preconditioner.
+    /// \param precond the type of preconditioner.
+    /// \param relaxfac relaxation parameter used for RILU and SSOR.
+    void setPreconditioner(Preconditioner precond, double relaxfac);
+
     /// Solve the equation system by conjugate gradient method.
     /// \param ex the solution vector.  The input should be the initial
     ///           guess.  Size is equal to nn.
@@ -91,6 +131,20 @@ public:
     /// \return 0: success, 1: iterationcount exceeded, < 0: error.
     int solve(double *ex, double *eb, int nn);
 
+    /// Solve the equation system for several right hand sides by
+    /// simultaneous conjugate gradient iterations. The systems share
+    /// each pass over the matrix, but are otherwise independent and
+    /// converge separately.
+    /// \param ex the solution vectors, stored one after the other. The
+    ///           input should be the initial guesses. Size is nn*nmb_rhs.
+    /// \param eb the right sides of the equation, stored one after the 
+    ///           other. Size is nn*nmb_rhs.
+    /// \param nn the number of unknowns in the system.
+    /// \param nmb_rhs the number of right hand sides.
+    /// \return 0: success, 1: iterationcount exceeded for at least one
+    ///         right hand side, < 0: error.
+    int solve(double *ex, double *eb, int nn, int nmb_rhs);
+
     /// Set numerical tolerance used by the solver.
     /// \param tolerance numerical tolerance.
     void setTolerance(double tolerance = 1.0e-6)
@@ -123,21 +177,37 @@ protected:
     std::vector<int> diagonal_;  // Index of diagonal elements in the jcol
     int diagset_; // Whether the index of the diagonal elements has been set.
 
+    Preconditioner precond_;   // Preconditioner other than RILU, which is
+                               // identified by M_ for compatibility with
+                               // sub classes
+    std::vector<double> D_;    // Inverse diagonal (Jacobi) or diagonal
+                               // scaled by the relaxation parameter (SSOR)
+
     /// Compute the matrix product sy = A_ * sx.
     /// \param sx the vector to be multiplied by the matrix.
     /// \param sy the resulting vector.
     template <typename RandomIterator1, typename RandomIterator2>
     void matrixProduct(RandomIterator1 sx, RandomIterator2 sy)
     {
-	int kj, ki;
+	int kj;
+#pragma omp parallel for schedule(static) if (np_ > 50000)
 	for(kj=0; kj<nn_; kj++) {
-	    sy[kj] = 0.0;
-	    for(ki=irow_[kj]; ki<irow_[kj+1]; ki++) {
-		sy[kj] += A_[ki] * sx[jcol_[ki]];
+	    double tmp = 0.0;
+	    for(int ki=irow_[kj]; ki<irow_[kj+1]; ki++) {
+		tmp += A_[ki] * sx[jcol_[ki]];
 	    }
+	    sy[kj] = tmp;
 	}
     }
 
+    /// Compute the matrix product sy = A_ * sx for nmb vectors stored
+    /// one after the other. The matrix is traversed once.
+    void matrixProduct(const double *sx, double *sy, int nmb);
+
+    /// Apply the current preconditioner, i.e. compute s = M^{-1} * r.
+    /// The identity is used if no preconditioner is set.
+    void applyPrecond(double *r, double *s);
+
     /// Given an index in the full equation system, get the index in A_.
     int getIndex(int ki, int kj);
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPARSEMATRIX_H_
+#define _SPARSEMATRIX_H_
+
+
+//   -----------------------------------------------------------------------
+//      Interface file for class SparseMatrix
+//   -----------------------------------------------------------------------
+//
+//       Square sparse matrix used when assembling the left side of
+//       the equation systems in the smoothing and approximation
+//       classes. Entries are created on first access, and the row
+//       structure can be exported in the compressed row format
+//       expected by SolveCG.
+//
+//   -----------------------------------------------------------------------
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Square sparse matrix with dynamic sparsity pattern. Each row stores
+/// the column indices of its entries in increasing order together with
+/// the values. The storage is proportional to the number of entries.
+class GO_API SparseMatrix
+{
+public:
+
+    /// Default constructor. Creates an empty matrix.
+    SparseMatrix();
+
+    /// Constructor.
+    /// \param nn number of rows and columns in the matrix.
+    explicit SparseMatrix(int nn);
+
+    /// Destructor.
+    ~SparseMatrix();
+
+    /// Change the number of rows and columns. Entries outside the new
+    /// size are removed, other entries are kept.
+    /// \param nn the new number of rows and columns.
+    void resize(int nn);
+
+    /// Remove all entries, keep the size.
+    void clear();
+
+    /// Set the value of all entries to zero, keep the sparsity pattern.
+    void zero();
+
+    /// Number of rows (and columns).
+    int size() const
+    { return (int)cols_.size(); }
+
+    /// Number of stored entries.
+    int numNonZeros() const;
+
+    /// Reference to the entry in row ki and column kj. The entry is
+    /// created with value zero if it does not exist.
+    double& entry(int ki, int kj);
+
+    /// Add a contribution to the entry in row ki and column kj.
+    void add(int ki, int kj, double val)
+    { entry(ki, kj) += val; }
+
+    /// The value of the entry in row ki and column kj, zero if
+    /// the entry does not exist.
+    double value(int ki, int kj) const;
+
+    /// Export the matrix in compressed row format. Entries with value
+    /// zero are not included.
+    /// \param A the values of the non-zero entries, row by row.
+    /// \param irow the index in A and jcol of the first entry of each row.
+    ///             Size is nn+1.
+    /// \param jcol the column index of each entry in A.
+    void getCompressedRows(std::vector<double>& A, std::vector<int>& irow,
+			   std::vector<int>& jcol) const;
+
+    /// Write the matrix to a dense, row-wise array of size nn*nn.
+    /// Intended for debugging of small systems.
+    void getDense(std::vector<double>& dense) const;
+
+private:
+    std::vector<std::vector<int> > cols_;     // Column indices for each row
+    std::vector<std::vector<double> > vals_;  // Entry values for each row
+
+};
+
+} // namespace Go
+
+#endif // _SPARSEMATRIX_H_
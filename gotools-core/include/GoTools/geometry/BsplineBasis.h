@@ -142,10 +142,28 @@ public:
     /// \param os the stream to which the BsplineBasis is written
     virtual void write_bin(std::ostream& os) const;
 
+    /// Read the BsplineBasis from a binary g2 stream.
+    /// \param is the stream from which the BsplineBasis is read.
+    virtual void readBinary(BinaryReader& is);
+
+    /// Write the BsplineBasis to a binary g2 stream.
+    /// \param os the stream to which the BsplineBasis is written
+    virtual void writeBinary(BinaryWriter& os) const;
+
     /// Find the interval in which the parameter value 't' lies.
     /// \param t the parameter value to test.
     int knotInterval(double t) const;
 
+    /// Find the interval in which the parameter value 't' lies, starting the
+    /// search from a caller-owned hint rather than from the interval cached in
+    /// the basis.  The basis itself is not modified, so this function can be
+    /// called concurrently on the same basis from several threads.
+    /// \param t the parameter value to test.
+    /// \param ileft on input a guess for the knot interval (any value is
+    ///              accepted), on output the index of the interval containing 't'.
+    /// \return the index of the interval containing 't' (equal to 'ileft').
+    int knotInterval(double t, int& ileft) const;
+
     /// Create a vector containing the basis values in a given parameter.
     /// \param t the parameter at which to evaluate the basis functions
     /// \param derivs the number of function derivatives to calculate for each nonzero
@@ -173,6 +191,24 @@ public:
 			    int derivs = 0,
 			    double resolution=1.0e-12) const; 
 
+    /// Reentrant version of computeBasisValues(double, double*, int, double).
+    /// The knot interval is located using, and returned in, the caller-owned
+    /// 'ileft' instead of the internal cache queried by lastKnotInterval(),
+    /// so the basis is left untouched.
+    /// \param t the parameter at which to evaluate the basis function
+    /// \param ileft on input a guess for the knot interval containing 't',
+    ///              on output the index of the left knot of that interval.
+    /// \param basisvals_start pointer to the memory area where the result will be
+    ///                        written, order()*('derivs'+1) doubles.
+    /// \param derivs number of derivatives to evaluate.
+    /// \param resolution accuracy for determining whether a given parametric value lies
+    ///                   exactly 'on' a knot.
+    void computeBasisValues(double t,
+			    int& ileft,
+			    double* basisvals_start,
+			    int derivs = 0,
+			    double resolution=1.0e-12) const; 
+
     /// Compute basis values for many points simultaneously.
     /// \param parvals_start pointer to the start of list of parameters where you 
     ///                      want to evaluate the basis functions
@@ -198,11 +234,17 @@ public:
     /// \param  derivs         number of derivatives that should be evaluated for each nonzero
     ///                        basis function (derivs = 0 => only function values will be 
     ///                        computed).
+    /// \param resolution      accuracy for determining whether a given parametric value
+    ///                        lies exactly 'on' a knot.
+    /// The knot interval search reuses the interval of the previous parameter, so
+    /// the function is most efficient when the parameters are sorted or grouped
+    /// by knot interval.  The internal interval cache of the basis is not used.
     void computeBasisValues(const double* parvals_start,
 			    const double* parvals_end,
 			    double* basisvals_start,
 			    int* knotinter_start,
-			    int derivs = 0) const;
+			    int derivs = 0,
+			    double resolution=1.0e-12) const;
 
     /// This function is similar to computeBasisValues(double, int), except that the 
     /// values are calculated from the left, as opposed to the default right-evaluation.
@@ -221,6 +263,17 @@ public:
 				int derivs,
 				double resolution=1.0e-12) const;
 
+    /// Reentrant version of computeBasisValuesLeft(double, double*, int, double).
+    /// \param ileft on input a guess for the knot interval containing 'tval',
+    ///              on output the index of the left knot of the interval used
+    ///              for the evaluation.
+    /// \see computeBasisValues(double, int&, double*, int, double)
+    void computeBasisValuesLeft(double tval, 
+				int& ileft,
+				double* basisvals_start,
+				int derivs,
+				double resolution=1.0e-12) const;
+
     /// This function is similar to computeBasisValues(const double*, const double*, 
     /// double*, int*, int), except that the values are calculated from the left, as opposed
     /// to the default right-evaluation.
@@ -228,7 +281,8 @@ public:
 				const double* parvals_end,
 				double* basisvals_start,
 				int* knotinter_start,
-				int derivs) const;
+				int derivs,
+				double resolution=1.0e-12) const;
 
     /// We want the new knot vector to be a mirror image of the old one,
     /// translated so that is starts and ends in the same values as before.
@@ -254,6 +308,11 @@ public:
     ///            that may be the primary wanted effect of this function.
     int knotIntervalFuzzy(double& t, double tol = DEFAULT_PARAMETER_EPSILON) const;
 
+    /// Reentrant version of knotIntervalFuzzy(double&, double), using the
+    /// caller-owned interval hint 'ileft' in the same way as
+    /// knotInterval(double, int&).
+    int knotIntervalFuzzy(double& t, int& ileft, double tol) const;
+
     /// Insert several knots into the knotvector
     /// \param new_knots a STL vector containing the new knots to insert into the vector
     void insertKnot(const std::vector<double>& new_knots);
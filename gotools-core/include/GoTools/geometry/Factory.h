@@ -107,10 +107,18 @@ namespace Go
 	/// \param class_type the ClassType for which we want the Factory to associate
 	///                   a particular Creator.
 	/// \param c pointer to the Creator object to be used by the Factory when creating
-	///          objects of type ClassType.
+	///          objects of type ClassType.  The Factory takes ownership of it.
 	void registerClass(ClassType class_type, Creator* c)
 	{
-	    themap_[class_type] = c;
+	    std::map<ClassType, Creator*>::iterator it;
+	    it = themap_.find(class_type);
+	    if (it != themap_.end()) {
+		if (it->second != c)
+		    delete it->second;
+		it->second = c;
+	    } else {
+		themap_[class_type] = c;
+	    }
 	}
 
 	/// This function returns a pointer to the unique, global Factory.
@@ -156,7 +164,6 @@ namespace Go
 	Factory* f = Factory::globalFactory();
 	ConcreteCreator<T>* c = new ConcreteCreator<T>;
 	f->registerClass(T::classType(), c);
-	delete c;
     }
 
     /** Work around for compilation problems.
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _G2BINARYFILE_H
+#define _G2BINARYFILE_H
+
+#include <vector>
+#include <string>
+#include "GoTools/geometry/GeomObject.h"
+#include "GoTools/geometry/ObjectHeader.h"
+#include "GoTools/utils/MappedFile.h"
+
+namespace Go
+{
+
+    /** Binary counterpart of the text g2 format.  A file holds a
+     *  sequence of GeomObjects, each stored by its writeBinary()
+     *  function, followed by an object table with the ObjectHeader,
+     *  offset and size of every object.  All numbers are little-endian,
+     *  and arrays of doubles are aligned to 8 bytes so that they can
+     *  be used directly from the memory mapped file.
+     *
+     *  When reading, the file is memory mapped and only the object
+     *  table is parsed.  The objects themselves are created through the
+     *  Factory when first requested, so the classes in question must
+     *  be registered (GoTools::init()) as for the text format.
+     *
+     *  Layout (version 1):
+     *  \verbatim
+     *  "GoG2Bin" '\0', version, 0, number of objects, 0   (32 bit ints)
+     *  object 0, padded to 8 bytes
+     *  ...
+     *  object table: per object ObjectHeader, offset, size (64 bit)
+     *  offset of object table (64 bit), "GoG2Bin" '\0'
+     *  \endverbatim
+     */
+
+class GO_API G2BinaryFile
+{
+public:
+    /// Open a binary g2 file for reading.  Throws if the file is not
+    /// a valid binary g2 file.
+    /// \param filename the file to open
+    explicit G2BinaryFile(const std::string& filename);
+
+    /// Destructor
+    ~G2BinaryFile();
+
+    /// Number of objects in the file
+    int numObjects() const
+    { return (int)headers_.size(); }
+
+    /// The header of an object. Available without reading the object.
+    /// \param idx index of the object
+    const ObjectHeader& header(int idx) const
+    { return headers_[idx]; }
+
+    /// Size in bytes of the stored object
+    /// \param idx index of the object
+    long long objectSize(int idx) const
+    { return sizes_[idx]; }
+
+    /// Get an object. The object is read from the file the first time
+    /// it is requested, and kept until releaseObject() is called.
+    /// \param idx index of the object
+    shared_ptr<GeomObject> object(int idx);
+
+    /// Drop the reference to an object read by object().
+    /// \param idx index of the object
+    void releaseObject(int idx);
+
+    /// True if the file is memory mapped, see MappedFile
+    bool isMapped() const
+    { return file_.isMapped(); }
+
+    /// Read all objects
+    /// \param objs the objects in the file, in the stored order
+    void readAll(std::vector<shared_ptr<GeomObject> >& objs);
+
+    /// Write objects to a binary g2 stream.  The stream must be opened
+    /// in binary mode.
+    /// \param os the stream to write to
+    /// \param objs the objects to write
+    /// \param headers object headers to store with the objects. If not
+    /// given, standard headers are stored, as by
+    /// GeomObject::writeStandardHeader()
+    static void write(std::ostream& os,
+		      const std::vector<shared_ptr<GeomObject> >& objs,
+		      const std::vector<ObjectHeader>* headers = 0);
+
+    /// Check if a file starts with the binary g2 identification
+    /// \param filename the file to check
+    static bool isG2BinaryFile(const std::string& filename);
+
+    /// Current version of the file format
+    static const int VERSION = 1;
+
+private:
+    MappedFile file_;
+    std::vector<ObjectHeader> headers_;
+    std::vector<long long> offsets_;
+    std::vector<long long> sizes_;
+    std::vector<shared_ptr<GeomObject> > objects_;
+};
+
+} // namespace Go
+
+
+#endif // _G2BINARYFILE_H
+
@@ -104,6 +104,14 @@ public:
     /// \param os the output stream to which the ObjectHeader is written
     virtual void write (std::ostream& os) const;
 
+    /// Read the ObjectHeader from a binary stream
+    /// \param is the binary stream from which the ObjectHeader is read
+    virtual void readBinary (BinaryReader& is);
+
+    /// Write the ObjectHeader to a binary stream
+    /// \param os the binary stream to which the ObjectHeader is written
+    virtual void writeBinary (BinaryWriter& os) const;
+
     /// Get the ClassType stored in this ObjectHeader
     ClassType classType() const { return class_type_; }
 
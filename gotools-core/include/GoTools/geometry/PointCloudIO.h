@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _POINTCLOUDIO_H
+#define _POINTCLOUDIO_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include "GoTools/utils/config.h"
+#include "GoTools/utils/MappedFile.h"
+
+namespace Go
+{
+
+/// Input and output of large point clouds. Two file formats are
+/// handled. The text format is the point cloud part of the g2
+/// format: an optional header line, the number of points and the
+/// values of all points. The number of values per point is not
+/// stored in text files and must be given when reading.  The binary
+/// format consists of a 32 byte header followed by the values of all
+/// points, stored as little-endian doubles or floats. Each point
+/// has 'dim' coordinates, possibly followed by 'nmb_attr' attributes
+/// (intensity, classification, ...).  Binary files are memory
+/// mapped. Text files are parsed multi-threaded when OpenMP is
+/// enabled.
+namespace PointCloudIO
+{
+
+  /// Storage precision of binary point files
+  enum Precision
+  {
+    DOUBLE_PRECISION = 0,
+    SINGLE_PRECISION = 1
+  };
+
+  /// Description of the contents of a point file
+  struct PointFileInfo
+  {
+    long long nmb_points;  // Number of points
+    int dim;               // Number of coordinates per point
+    int nmb_attr;          // Number of attributes per point
+    Precision precision;   // Precision of stored values (binary files)
+    bool binary;           // Binary or text file
+
+    PointFileInfo()
+      : nmb_points(0), dim(0), nmb_attr(0), precision(DOUBLE_PRECISION),
+	binary(false)
+    {}
+
+    /// Number of values per point
+    int stride() const
+    { return dim + nmb_attr; }
+  };
+
+  /// Check if a file is a binary point file
+  GO_API bool isBinaryPointFile(const std::string& filename);
+
+  /// Write points to a binary point file. The stream must be opened
+  /// in binary mode.
+  /// \param points the values of all points, stored consecutively
+  /// with dim + nmb_attr values per point
+  GO_API void writeBinaryPoints(std::ostream& os, const double* points,
+				long long nmb_points, int dim, int nmb_attr = 0,
+				Precision precision = DOUBLE_PRECISION);
+
+  /// Read all points in a file, text or binary. The points are read
+  /// directly into 'points', there is no intermediate storage.
+  /// \param del the number of values per point in text files. For
+  /// binary files del must be zero or equal to dim + nmb_attr of the
+  /// file
+  /// \param points the values of all points, stored consecutively
+  /// \param info description of the file contents
+  GO_API void readPoints(const std::string& filename, int del,
+			 std::vector<double>& points, PointFileInfo& info);
+
+  /// Parse 'nmb' whitespace separated numbers in [begin, end)
+  /// into 'result'. Large blocks are parsed multi-threaded if OpenMP
+  /// is enabled. Throws if fewer numbers are found.
+  /// \return pointer past the last number parsed
+  GO_API const char* parseNumbers(const char* begin, const char* end,
+				  long long nmb, double* result);
+
+
+  /// Access to the points of a file without copying. A binary file
+  /// stored in double precision is memory mapped privately and the
+  /// points are used directly from the mapping.  The points may be
+  /// modified (i.e. sorted), modified pages are copied on write and
+  /// the file is never changed. Other files are read into memory.
+class GO_API MappedPoints
+{
+public:
+    /// Constructor
+    /// \param del number of values per point in text files, see
+    /// readPoints()
+    explicit MappedPoints(const std::string& filename, int del = 0);
+
+    /// The values of all points, stored consecutively with
+    /// info().stride() values per point
+    double* points()
+    { return points_; }
+
+    /// Number of points
+    long long numPoints() const
+    { return info_.nmb_points; }
+
+    /// Description of the file contents
+    const PointFileInfo& info() const
+    { return info_; }
+
+    /// True if the points are used directly from the memory mapped
+    /// file
+    bool isZeroCopy() const
+    { return (file_.get() != 0); }
+
+private:
+    PointFileInfo info_;
+    shared_ptr<MappedFile> file_;
+    std::vector<double> buffer_;
+    double* points_;
+};
+
+
+  /// Reads the points of a file in chunks of a given maximum size,
+  /// to process point clouds that do not fit in memory
+class GO_API PointChunkReader
+{
+public:
+    /// Constructor
+    /// \param del number of values per point in text files, see
+    /// readPoints()
+    explicit PointChunkReader(const std::string& filename, int del = 0);
+
+    /// Description of the file contents
+    const PointFileInfo& info() const
+    { return info_; }
+
+    /// Read the next chunk of points
+    /// \param chunk the values of the points read
+    /// \param max_points maximum number of points to read
+    /// \return number of points read, 0 when all points are read
+    long long nextChunk(std::vector<double>& chunk, long long max_points);
+
+    /// Number of points read so far
+    long long numRead() const
+    { return nmb_read_; }
+
+private:
+    PointFileInfo info_;
+    MappedFile file_;
+    const char* curr_;  // Position of the next point
+    long long nmb_read_;
+};
+
+} // namespace PointCloudIO
+
+} // namespace Go
+
+#endif // _POINTCLOUDIO_H
@@ -170,6 +170,12 @@ public:
     // Inherited from Streamable
     virtual void write (std::ostream& os) const;
 
+    // Inherited from Streamable
+    virtual void readBinary (BinaryReader& is);
+
+    // Inherited from Streamable
+    virtual void writeBinary (BinaryWriter& os) const;
+
     // Inherited from GeomObject
     virtual BoundingBox boundingBox() const;
 
@@ -355,6 +361,22 @@ public:
     void gridEvaluator(std::vector<double>& points,
 		       const std::vector<double>& par) const;
 
+    /// Evaluate points, and optionally derivatives, in a set of scattered
+    /// parameter values.  The samples are grouped by knot interval and the
+    /// coefficients of each interval are applied to all its samples in one
+    /// vectorizable sweep.  No Point objects are created and the evaluation
+    /// is reentrant.
+    /// \param num number of parameter values
+    /// \param param pointer to the 'num' parameter values
+    /// \param derivs number of derivatives to compute, at most 2
+    /// \param result pointer to caller-allocated storage for
+    ///               num*(derivs+1)*dimension() doubles.  For each sample,
+    ///               the position is followed by the derivatives.
+    void batchEvaluator(int num,
+			const double* param,
+			int derivs,
+			double* result) const;
+
     /// Get a const reference to the BsplineBasis of the curve
     /// \return const reference to the curve's BsplineBasis.
     const BsplineBasis& basis() const
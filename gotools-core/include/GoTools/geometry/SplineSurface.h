@@ -370,6 +370,12 @@ class GO_API SplineSurface : public ParamSurface
     // inherited from Streamable
     virtual void write (std::ostream& os) const;
 
+    // inherited from Streamable
+    virtual void readBinary (BinaryReader& is);
+
+    // inherited from Streamable
+    virtual void writeBinary (BinaryWriter& os) const;
+
 
     // inherited from GeomObject
     virtual BoundingBox boundingBox() const;
@@ -1163,6 +1169,27 @@ class GO_API SplineSurface : public ParamSurface
 		       std::vector<double>& derivs_v,
 		       bool evaluate_from_right = true) const;
 
+    /// Evaluate points, and optionally derivatives, in a set of scattered
+    /// parameter pairs.  The samples are grouped by knot span internally so
+    /// that the coefficients of each span are combined with the basis values
+    /// of all its samples in one vectorizable sweep.  No Point objects are
+    /// created and the evaluation is reentrant.
+    /// \param num number of parameter pairs
+    /// \param param_u pointer to the 'num' values of the first parameter
+    /// \param param_v pointer to the 'num' values of the second parameter
+    /// \param derivs number of derivatives to compute, at most 2
+    /// \param result pointer to caller-allocated storage for
+    ///               num*(derivs+1)*(derivs+2)/2*dimension() doubles.  For each
+    ///               sample, the position and derivatives are stored
+    ///               consecutively in the order used by 
+    ///               point(std::vector<Point>&, double, double, int, bool, bool, double),
+    ///               i.e. S, S_u, S_v, S_uu, S_uv, S_vv.
+    void batchEvaluator(int num,
+			const double* param_u,
+			const double* param_v,
+			int derivs,
+			double* result) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter pair
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -284,6 +284,16 @@ namespace SplineUtils {
     // We insert knots so that all inner knots are of mult 'order'.
     shared_ptr<SplineSurface> GO_API refineToBezier(const Go::SplineSurface& spline_sf);
 
+    /// Compute a permutation that groups a set of samples by the knot span
+    /// they belong to, keeping the original order within each span.
+    /// A counting sort is used when the number of spans is moderate compared
+    /// to the number of samples.
+    /// \param span the span index of each sample, in the range [0, num_spans)
+    /// \param num_spans the total number of spans
+    /// \param perm upon function return, the sample indices ordered by span
+    void GO_API sortBySpan(const std::vector<int>& span, int num_spans,
+			   std::vector<int>& perm);
+
     // This refinement routine should replace the (slow) version
     // currently used in SplineSurface.
     shared_ptr<SplineSurface> GO_API insertKnots(const Go::SplineSurface& spline_sf,
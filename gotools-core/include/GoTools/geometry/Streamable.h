@@ -48,6 +48,9 @@
 namespace Go
 {
 
+class BinaryWriter;
+class BinaryReader;
+
     /** 
      *  Base class for streamable objects, i.e., objects which can be read from
      *  and written to a stream.
@@ -65,6 +68,16 @@ public:
     /// \param os stream to which object is written
     virtual void write (std::ostream& os) const = 0;
 
+    /// write object to a binary stream, as used by the binary g2
+    /// format (see G2BinaryFile).  The default implementation stores
+    /// the text representation given by write(), with doubles written
+    /// with enough digits to be read back exactly.
+    /// \param os binary stream to which object is written
+    virtual void writeBinary (BinaryWriter& os) const;
+    /// read object from a binary stream, as written by writeBinary()
+    /// \param is binary stream from which object is read
+    virtual void readBinary (BinaryReader& is);
+
     // Exception class
     class EofException{};
 };
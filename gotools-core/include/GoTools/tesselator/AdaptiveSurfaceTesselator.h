@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef ADAPTIVESURFACETESSELATOR_H
+#define ADAPTIVESURFACETESSELATOR_H
+
+#include "GoTools/tesselator/Tesselator.h"
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/geometry/ParamCurve.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/** AdaptiveSurfaceTesselator: create a triangulation of a possibly
+    trimmed surface where the size of the triangles follows the shape of
+    the surface. The parameter domain is refined starting from the knot
+    spans of spline surfaces. A cell is split in two in the parameter
+    direction where the surface deviates most from the cell until the 
+    distance between the surface and the triangles is within a chordal
+    tolerance and the normals within a cell deviate less than an angular
+    tolerance. Cells in the inner of the trimmed domain are split into
+    triangles. The region between these cells and the trimming loops is
+    triangulated with the loop points as nodes, and these triangles are
+    refined with respect to the same tolerances.
+*/
+
+class GO_API AdaptiveSurfaceTesselator : public Tesselator
+{
+public:
+    /// Constructor. Surface and tolerances are given. The chordal
+    /// tolerance is the allowed distance between the triangles and
+    /// the surface, the angular tolerance is the allowed angle in
+    /// radians between the surface normals at the nodes of a cell
+    AdaptiveSurfaceTesselator(const ParamSurface& surf, 
+			      double chord_tol, double ang_tol);
+
+    virtual ~AdaptiveSurfaceTesselator();
+
+    /// Prescribe the points along the boundary. This is used to get
+    /// the same points along the common boundary of adjacent surfaces.
+    /// Each loop is given as parameter values in the domain of the
+    /// underlying surface (two per point) and positions (three per point).
+    /// The first point is not repeated at the end. The first loop is 
+    /// the outer one. If no loops are given, the boundary of the surface 
+    /// is sampled with respect to the tolerances
+    void setBoundaryLoops(const std::vector<std::vector<double> >& par_loops,
+			  const std::vector<std::vector<double> >& pos_loops);
+
+    virtual void tesselate();
+
+    /// Fetch the resulting mesh. Nodes at the boundary loops are flagged
+    /// as boundary nodes
+    shared_ptr<GenericTriMesh> getMesh()
+    {
+	return mesh_;
+    }
+
+    /// Set the maximum number of refinements of the initial cells in
+    /// each parameter direction. The tolerances may not be met if
+    /// the level is reached
+    void setMaxLevel(int level)
+    {
+	max_level_ = level;
+    }
+
+    /// Sample a curve such that the polygon through the sample points 
+    /// lies within the chordal tolerance of the curve and the angle 
+    /// between the curve tangents at consecutive points is within
+    /// the angular tolerance. tstart may be larger than tend, the
+    /// parameters are returned in the sequence from tstart to tend
+    static void sampleCurve(const ParamCurve& cv, double tstart, double tend,
+			    double chord_tol, double ang_tol,
+			    std::vector<double>& par, int max_level = 10);
+
+private:
+    const ParamSurface& surf_;
+    double chord_tol_;
+    double ang_tol_;
+    int max_level_;
+    std::vector<std::vector<double> > par_loops_;
+    std::vector<std::vector<double> > pos_loops_;
+    shared_ptr<GenericTriMesh> mesh_;
+
+    // Sample the boundary of the surface if no loops are given
+    void sampleBoundary(const ParamSurface& base_sf);
+};
+
+} // namespace Go
+
+#endif // ADAPTIVESURFACETESSELATOR_H
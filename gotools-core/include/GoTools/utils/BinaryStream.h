@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BINARYSTREAM_H
+#define _BINARYSTREAM_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+    /// Writes raw little-endian binary data to a stream. Used for the
+    /// binary g2 format, see G2BinaryFile. Integers are stored as 32
+    /// or 64 bit, floating point numbers as IEEE doubles. The stream
+    /// must be opened in binary mode.
+class GO_API BinaryWriter
+{
+public:
+    /// Constructor
+    /// \param os the stream to write to
+    explicit BinaryWriter(std::ostream& os)
+	: os_(os), pos_(0)
+    {}
+
+    void writeInt(int val);
+    void writeInt64(long long val);
+    void writeDouble(double val);
+    void writeInts(const int* vals, size_t nmb);
+    void writeDoubles(const double* vals, size_t nmb);
+    void writeBytes(const char* data, size_t nmb);
+
+    /// Pad with zeros up to the next multiple of 8 bytes, counted
+    /// from the start of the stream.  Arrays of doubles written after
+    /// align() can be used directly from a memory mapped file.
+    void align();
+
+    /// Number of bytes written so far
+    long long position() const
+    { return pos_; }
+
+private:
+    std::ostream& os_;
+    long long pos_;
+};
+
+
+    /// Reads binary data written by BinaryWriter from a block of
+    /// memory, typically a memory mapped file, see MappedFile.  Arrays
+    /// are returned as pointers into the memory block whenever the
+    /// byte order and alignment permit, so that large coefficient
+    /// arrays are not copied more than once.
+class GO_API BinaryReader
+{
+public:
+    /// Constructor
+    /// \param data start of the memory block
+    /// \param size size of the memory block in bytes
+    BinaryReader(const char* data, size_t size)
+	: data_(data), size_(size), pos_(0)
+    {}
+
+    int readInt();
+    long long readInt64();
+    double readDouble();
+
+    /// Read an array of integers.
+    /// \param nmb number of integers
+    /// \param buf storage used if the data can not be referred to
+    /// directly
+    /// \return pointer to the integers, valid as long as the memory
+    /// block and buf are valid
+    const int* readInts(size_t nmb, std::vector<int>& buf);
+
+    /// Read an array of doubles.
+    /// \param nmb number of doubles
+    /// \param buf storage used if the data can not be referred to
+    /// directly
+    /// \return pointer to the doubles, valid as long as the memory
+    /// block and buf are valid
+    const double* readDoubles(size_t nmb, std::vector<double>& buf);
+
+    /// Read a block of bytes
+    /// \return pointer to the first byte in the memory block
+    const char* readBytes(size_t nmb);
+
+    /// Skip padding written by BinaryWriter::align()
+    void align();
+
+    /// Current position, relative to the start of the memory block
+    size_t position() const
+    { return pos_; }
+
+    /// Check if all data is read
+    bool atEnd() const
+    { return pos_ >= size_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+
+    const char* advance(size_t nmb_bytes);
+};
+
+
+    /// Check if the current platform stores numbers in little-endian
+    /// byte order, which is the order used in binary files.
+    GO_API bool hostIsLittleEndian();
+
+} // namespace Go
+
+
+#endif // _BINARYSTREAM_H
+
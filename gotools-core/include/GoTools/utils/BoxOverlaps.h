@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BOXOVERLAPS_H
+#define _BOXOVERLAPS_H
+
+#include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <utility>
+
+namespace Go {
+
+/// Find all pairs of overlapping boxes by sweep and prune along the
+/// coordinate direction where the boxes are most spread out. The result
+/// is the same as testing all pairs with BoundingBox::overlaps(), but the
+/// cost is close to O(n log n) unless a large fraction of the boxes
+/// overlap each other.
+/// \param boxes The boxes, all of the same dimension
+/// \param tol Tolerance passed on to BoundingBox::overlaps()
+/// \param pairs Index pairs (i,j) with i < j, sorted lexicographically
+void GO_API overlappingBoxPairs(const std::vector<BoundingBox>& boxes,
+				double tol,
+				std::vector<std::pair<int,int> >& pairs);
+
+} // end namespace Go
+
+#endif // _BOXOVERLAPS_H
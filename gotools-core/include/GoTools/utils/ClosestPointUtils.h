@@ -42,6 +42,7 @@
 
 
 #include <vector>
+#include <iostream>
 #include "GoTools/utils/Point.h"
 #include "GoTools/geometry/GeomObject.h"
 
@@ -122,7 +123,7 @@ namespace Go
       }
 
       /// Get a specific copy of the surface
-      shared_ptr<ParamSurface> surface(int idx) const
+      const shared_ptr<ParamSurface>& surface(int idx) const
 	{
 	  return surfaces_[idx];
 	}
@@ -134,7 +135,7 @@ namespace Go
       }
 
       /// Get the internal surface points
-      std::vector<Point> inside_points() const
+      const std::vector<Point>& inside_points() const
 	{
 	  return inside_points_;
 	}
@@ -275,19 +276,19 @@ namespace Go
       }
 
       /// Get the geometry space bounding box of the image of the segment
-      BoundingBox box() const
+      const BoundingBox& box() const
       {
 	return box_;
       }
 
       /// Get the structure data of the surface
-      shared_ptr<SurfaceData> surface_data() const
+      const shared_ptr<SurfaceData>& surface_data() const
       {
 	return surface_data_;
       }
 
       /// Get the domain of the segment in the surface parameter domain
-      shared_ptr<RectDomain> par_domain() const
+      const shared_ptr<RectDomain>& par_domain() const
       {
 	return par_domain_;
       }
@@ -387,13 +388,13 @@ namespace Go
       }
 
       /// Get a specific segment in the structure
-      shared_ptr<SubSurfaceBoundingBox> getBox(int i) const
+      const shared_ptr<SubSurfaceBoundingBox>& getBox(int i) const
       {
 	return boxes_[i];
       }
 
       /// Get a specific surface in the structure
-      shared_ptr<SurfaceData> getSurface(int i) const
+      const shared_ptr<SurfaceData>& getSurface(int i) const
       {
 	return surfaces_[i];
       }
@@ -417,7 +418,7 @@ namespace Go
       }
 
       /// Get the lower left corner of the entire voxel structure
-      Point big_vox_low() const
+      const Point& big_vox_low() const
       {
 	return big_vox_low_;
       }
@@ -430,7 +431,7 @@ namespace Go
 
       /// Get all the segments that might hit a given voxel
       /// (those where the bounding boxes hit the voxel)
-      std::vector<int> boxes_in_voxel(int i, int j, int k) const
+      const std::vector<int>& boxes_in_voxel(int i, int j, int k) const
       {
 	return boxes_in_voxel_[i][j][k];
       }
@@ -553,12 +554,29 @@ namespace Go
   shared_ptr<boxStructuring::BoundingBoxStructure> preProcessClosestVectors(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el);
 
 
+  /// Result of the previous closest point calculation in a thread. When the next point has a candidate in
+  /// the same segment, the parameter values are used as start values for the closest point iteration.
+  struct PreviousClosestPoint
+  {
+    /// The segment (box) where the closest point was found, -1 if not known
+    int box_idx_;
+    double par_u_;
+    double par_v_;
+
+    PreviousClosestPoint()
+      : box_idx_(-1), par_u_(0.0), par_v_(0.0)
+    {
+    }
+  };
+
+  /// Calculate the closest point for a single point. If previous is not NULL, the result of the previous
+  /// calculation in the same thread is used as start values where possible, and is updated with the new result.
   void closestPointSingleCalculation(int pt_idx, int start_idx, int skip,
 				     const std::vector<float>& inPoints,
 				     const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
 				     const shared_ptr<boxStructuring::BoundingBoxStructure>& boxStructure,
 				     std::vector<float>& result, std::vector<std::vector<int> >& lastBoxCall,
-				     int return_type, int search_extend);
+				     int return_type, int search_extend, PreviousClosestPoint* previous = NULL);
 
   /// Calculates the closest points of a point cloud to a surface model, after a SO(3)-rotation and translation is applied on the point clod.
   /// The method uses polygons inside the bounding curves on paramter domains to help determining if parameter pairs are inside the
@@ -577,11 +595,27 @@ namespace Go
   /// search_extend  - Used to define the number of segments to be added in each direction when defining the parameter subset on which
   ///                  the closest point functions should be performed. Will be removed.
   /// m_core         - Whether the calculations should be performed in parallell on multiple cores (only if OPENMP is included)
+  /// The points are split into chunks of consecutive points with approximately the same estimated cost, based on the number
+  /// of segments near each point. The chunks are handed out dynamically to the threads. Within a chunk, the result for one
+  /// point is used as start values for the next, thus spatially coherent point clouds are favourable. The result does not
+  /// depend on the number of threads.
   /// returns   A vector of the distances to the closest points for the subset on which the calculations are performed.
   std::vector<float> closestPointCalculations(const std::vector<float>& pts, const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
 					      const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
 					      int return_type, int start_idx, int skip, int max_idx, int search_extend = 3, bool m_core = true);
 
+  /// Closest point calculations on a point cloud read from a stream, for point clouds too large to be kept in memory.
+  /// The points are read and processed in batches of batch_size points, and the results of each batch are written
+  /// before the next batch is read.
+  /// is             - The point cloud, three coordinates for each point
+  /// os             - The results, one line for each point. The content is given by return_type as for closestPointCalculations()
+  /// batch_size     - Maximum number of points kept in memory
+  /// returns   The number of points processed
+  long closestPointCalculations(std::istream& is, std::ostream& os,
+				const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
+				const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
+				int return_type, int batch_size = 1000000, int search_extend = 3, bool m_core = true);
+
 
   /// Calculates the closest points of a point cloud to a surface model, by not using the inside polygons in closestVectors()
   std::vector<float> closestVectorsOld(const std::vector<float>& inPoints, const shared_ptr<boxStructuring::BoundingBoxStructure>& boxStructure,
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+    /// Read-only view of the contents of a file.  The file is memory
+    /// mapped where the platform supports it, so pages are loaded by
+    /// the operating system when accessed and shared with the file
+    /// cache.  Otherwise the file is read into memory.
+
+class GO_API MappedFile
+{
+public:
+    /// Constructor. Throws if the file can not be opened.
+    /// \param filename the file to map
+    /// \param writable if true, the contents may be modified through
+    ///        writableData(). The mapping is private, modified pages
+    ///        are copied on write and the file itself is never changed
+    explicit MappedFile(const std::string& filename, bool writable = false);
+
+    /// Destructor. Unmaps the file.
+    ~MappedFile();
+
+    /// Start of the file contents
+    const char* data() const
+    { return data_; }
+
+    /// Start of the file contents, for files opened as writable.
+    /// Returns 0 otherwise
+    char* writableData()
+    { return writable_ ? const_cast<char*>(data_) : 0; }
+
+    /// Size of the file in bytes
+    size_t size() const
+    { return size_; }
+
+    /// True if the file is memory mapped, false if it is read into
+    /// memory
+    bool isMapped() const
+    { return mapped_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    bool mapped_;
+    bool writable_;
+    std::vector<char> buffer_;  // Used if the file is not mapped
+
+    // Not copyable
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+} // namespace Go
+
+
+#endif // _MAPPEDFILE_H
+
@@ -59,13 +59,51 @@ namespace Go {
  *  multiplication by scalars etc, and objects will sometimes be
  *  called 'vectors' in the following. Based on double precision floating
  *  point numbers.
+ *  Points of dimension up to 4 store their elements inside the object,
+ *  only larger points allocate memory on the heap.
  */
 class GO_API Point
 {
 private:
+    /// Largest dimension stored without heap allocation
+    enum { LOCAL_DIM = 4 };
+
     double* pstart_;
     int n_;
     bool owns_;
+    double local_[LOCAL_DIM];
+
+    // Set up owned, uninitialized storage for 'dim' elements. Any
+    // previously held storage must have been released.
+    void allocate(int dim)
+    {
+	n_ = dim;
+	owns_ = true;
+	pstart_ = (dim <= LOCAL_DIM) ? local_ : new double[dim];
+    }
+
+    // Whether the elements are stored in memory allocated by this point
+    bool onHeap() const
+    {
+	return owns_ && pstart_ != local_;
+    }
+
+    // Take over the contents of 'v', leaving 'v' as an empty point.
+    // Any storage held by this point must have been released.
+    void take(Point& v)
+    {
+	n_ = v.n_;
+	owns_ = v.owns_;
+	if (v.pstart_ == v.local_) {
+	    pstart_ = local_;
+	    std::copy(v.local_, v.local_ + n_, local_);
+	} else {
+	    pstart_ = v.pstart_;
+	}
+	v.pstart_ = 0;
+	v.n_ = 0;
+	v.owns_ = true;
+    }
 
 public:
     /// Default constructor, does not initialize elements.
@@ -79,15 +117,15 @@ public:
     /// Resulting point is of the specified dimension,
     /// and initialized to zero
     explicit Point(int dim)
-	: pstart_(new double[dim]), n_(dim), owns_(true)
     {
-      for (int ki=0; ki<dim; ++ki)
-	pstart_[ki] = 0.0;
+	allocate(dim);
+	for (int ki=0; ki<dim; ++ki)
+	    pstart_[ki] = 0.0;
     }
     /// Constructor taking 2 arguments, makes the
     /// 2D-point (x,y).
     Point(double x, double y)
-	: pstart_(new double[2]), n_(2), owns_(true)
+	: pstart_(local_), n_(2), owns_(true)
     {
 	pstart_[0] = x;
 	pstart_[1] = y;
@@ -95,7 +133,7 @@ public:
     /// Constructor taking 3 arguments, makes the
     /// 3D-point (x,y,z).
     Point(double x, double y, double z)
-	: pstart_(new double[3]), n_(3), owns_(true)
+	: pstart_(local_), n_(3), owns_(true)
     {
 	pstart_[0] = x;
 	pstart_[1] = y;
@@ -109,9 +147,8 @@ public:
     // "internal compiler error" !) @jbt
     template <typename T, int Dim>
     explicit Point(const Array<T, Dim>& v)
-	: pstart_(0), n_(Dim), owns_(true)
     {
-	pstart_ = new double[n_];
+	allocate(Dim);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(v.begin(), v.end(), pstart_);
 #else
@@ -123,9 +160,8 @@ public:
     /// Constructor making a Point from an iterator range.
     template <typename RandomAccessIterator>
     Point(RandomAccessIterator first, RandomAccessIterator last)
-	: pstart_(0), n_((int)(last - first)), owns_(true)
     {
-	pstart_ = new double[n_];
+	allocate((int)(last - first));
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(first, last, pstart_);
 #else
@@ -163,10 +199,9 @@ public:
     /// to the input data, and not own them. If it is true,
     /// it will act as a regular point, owning its data.
     Point(double* begin, double* end, bool own)
-	: pstart_(0), n_((int)(end-begin)), owns_(own)
     {
-	if (owns_) {
-	    pstart_ = new double[n_];
+	if (own) {
+	    allocate((int)(end-begin));
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	    std::copy(begin, end, pstart_);
 #else
@@ -174,14 +209,15 @@ public:
 #endif // _MSC_VER
 	} else {
 	    pstart_ = begin;
+	    n_ = (int)(end-begin);
+	    owns_ = false;
 	}
     }
 
     /// Copy constructor.
     Point(const Point& v)
-	: pstart_(0), n_(v.n_), owns_(true)
     {
-	pstart_ = new double[n_];
+	allocate(v.n_);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(v.pstart_, v.pstart_ + n_, pstart_);
 #else
@@ -189,26 +225,57 @@ public:
 #endif // _MSC_VER
     }
 
+    /// Move constructor. A Point referring to external data keeps
+    /// referring to the same data. It does not throw, so that
+    /// std::vector<Point> moves its elements when it grows.
+    Point(Point&& v) noexcept
+    {
+	take(v);
+    }
+
     /// Assignment operator.
     Point& operator = (const Point &v)
     {
-	Point temp(v);
-	swap(temp);
+	if (this == &v)
+	    return *this;
+	if (owns_ && v.n_ <= LOCAL_DIM) {
+	    // Reuse the local storage
+	    std::copy(v.pstart_, v.pstart_ + v.n_, local_);
+	    if (onHeap())
+		delete [] pstart_;
+	    pstart_ = local_;
+	    n_ = v.n_;
+	} else {
+	    Point temp(v);
+	    swap(temp);
+	}
+	return *this;
+    }
+
+    /// Move assignment operator.
+    Point& operator = (Point&& v) noexcept
+    {
+	if (this != &v) {
+	    if (onHeap())
+		delete [] pstart_;
+	    take(v);
+	}
 	return *this;
     }
 
     /// Destructor.
     ~Point()
     {
-	if (owns_) delete [] pstart_;
+	if (onHeap()) delete [] pstart_;
     }
 
     /// Swaps two Point instances. Never throws.
     void swap(Point& other)
     {
-	std::swap(pstart_, other.pstart_);
-	std::swap(n_, other.n_);
-	std::swap(owns_, other.owns_);
+	Point temp;
+	temp.take(*this);
+	take(other);
+	other.take(temp);
     }
 
     /// Reads a Point elementwise from
@@ -244,8 +311,13 @@ public:
     void resize(int d)
     {
 	if (n_ < d) {
-	    Point temp(d);
-	    swap(temp);
+	    if (owns_ && pstart_ == local_ && d <= LOCAL_DIM) {
+		n_ = d;
+		setValue(0.0);
+	    } else {
+		Point temp(d);
+		swap(temp);
+	    }
 	} else {
 	    n_ = d;
 	}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SFSFPARALLELINTERSECTOR_H
+#define _SFSFPARALLELINTERSECTOR_H
+
+
+#include "GoTools/intersections/SfSfIntersector.h"
+#include "GoTools/intersections/IntersectionCurve.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include <vector>
+
+
+namespace Go {
+
+
+/// This class performs intersection between two parametric surfaces
+/// by splitting the problem into independent sub problems that are
+/// solved concurrently.
+///
+/// The subdivision recursion in SfSfIntersector cannot itself be run
+/// in parallel: sibling sub intersectors share intersection points
+/// with each other and with the parent pool. Instead, both surfaces
+/// are split into a regular grid of sub surfaces up front, and every
+/// pair of sub surfaces with overlapping bounding boxes is given to
+/// an independent top level SfSfIntersector with its own
+/// IntersectionPool. When OpenMP is enabled, the pairs are computed
+/// concurrently. The results are merged in pair order, identifying
+/// intersection points found along the common boundaries of
+/// neighbouring sub surfaces. The merged points are made on
+/// intersection objects for the whole surfaces, and the intersection
+/// curves are recomputed from the resulting connectivity. Thus a
+/// curve crossing several sub surfaces is evaluated and refined on
+/// the whole surfaces. The result is independent of the number of
+/// threads.
+///
+/// The intersection points refer to the intersection objects owned
+/// by this class, so the intersector must be kept alive as long as
+/// the result is in use.
+
+class SfSfParallelIntersector {
+public:
+    /// Constructor.
+    /// \param surf1 the first surface.
+    /// \param surf2 the second surface.
+    /// \param epsge the geometric tolerance.
+    /// \param nmb_div the number of sub surfaces in each parameter
+    /// direction of each surface.  With nmb_div = 1 the computation
+    /// is equivalent to using SfSfIntersector directly.
+    SfSfParallelIntersector(shared_ptr<ParamSurface> surf1,
+			    shared_ptr<ParamSurface> surf2,
+			    double epsge, int nmb_div = 2);
+
+    /// Destructor
+    ~SfSfParallelIntersector();
+
+    /// Compute the intersections.
+    void compute();
+
+    /// Get intersection points and curves.  The intersection points
+    /// are isolated.
+    /// \param int_points vector of intersection points
+    /// \param int_curves vector of intersection curves
+    void getResult(std::vector<shared_ptr<IntersectionPoint> >& int_points,
+		   std::vector<shared_ptr<IntersectionCurve> >& int_curves) const
+    {
+	int_points = int_points_;
+	int_curves = int_curves_;
+    }
+
+    /// The number of sub surface pairs that were passed on to
+    /// SfSfIntersector in the last call to compute().
+    int numSubProblems() const
+    { return (int)sub_intersectors_.size(); }
+
+private:
+    shared_ptr<ParamSurface> surf1_;
+    shared_ptr<ParamSurface> surf2_;
+    double epsge_;
+    int nmb_div_;
+
+    // Intersection objects for the whole surfaces
+    shared_ptr<ParamGeomInt> obj1_;
+    shared_ptr<ParamGeomInt> obj2_;
+
+    std::vector<shared_ptr<SfSfIntersector> > sub_intersectors_;
+    std::vector<shared_ptr<IntersectionPoint> > int_points_;
+    std::vector<shared_ptr<IntersectionCurve> > int_curves_;
+
+    // Split a surface into nmb_div_ x nmb_div_ sub surfaces
+    void splitSurface(shared_ptr<ParamSurface> surf,
+		      std::vector<shared_ptr<ParamSurface> >& sub_sfs) const;
+
+    // Merge the results of the sub intersectors
+    void mergeResults();
+};
+
+
+} // namespace Go
+
+
+#endif // _SFSFPARALLELINTERSECTOR_H
+
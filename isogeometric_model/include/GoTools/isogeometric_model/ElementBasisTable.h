@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __ELEMENTBASISTABLE_H
+#define __ELEMENTBASISTABLE_H
+
+
+#include "GoTools/geometry/BsplineBasis.h"
+#include <vector>
+
+
+namespace Go
+{
+
+  // Univariate B-spline values and first derivatives in the Gauss points
+  // of all non-empty knot intervals (elements) of a B-spline basis. The
+  // values are stored contiguously element by element, such that the
+  // tables in each parameter direction can be combined by sum factorisation
+  // in the tensor product assembly of SfAssembler and VolAssembler
+
+  struct ElementBasisTable
+  {
+    // Evaluate the basis in the Gauss points chosen by GaussQuadValues()
+    // for the order of the basis. Knot intervals of zero length are skipped
+    void build(const BsplineBasis& basis);
+
+    // Number of elements
+    int nmbElements() const
+    {
+      return (int)first_.size();
+    }
+
+    int order_;                    // Order of the basis
+    int nmb_quad_;                 // Number of Gauss points in each element
+    std::vector<int> first_;       // Index of the first non-zero basis function
+                                   // in each element
+    std::vector<double> knot_;     // Element limits, size nmbElements()+1
+    std::vector<double> param_;    // Gauss points, element by element
+    std::vector<double> weight_;   // Gauss weights including the element length
+    std::vector<double> val_;      // Basis values, [element][Gauss point][order]
+    std::vector<double> der_;      // Basis derivatives, same layout as val_
+  };
+
+} // end namespace Go
+
+
+#endif    // #ifndef __ELEMENTBASISTABLE_H
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __SFASSEMBLER_H
+#define __SFASSEMBLER_H
+
+
+#include "GoTools/isogeometric_model/SfSolution.h"
+#include "GoTools/isogeometric_model/ElementBasisTable.h"
+#include "GoTools/creators/SparseMatrix.h"
+#include <vector>
+#include <memory>
+
+
+namespace Go
+{
+
+  // Galerkin assembly of the bilinear form
+  //     a(u,v) = diffusion * (grad u, grad v) + reaction * (u, v)
+  // and the corresponding load vector for the solution space of one block
+  // in an isogeometric surface model. The basis functions and the geometry
+  // factors are evaluated once, at construction, and stored in contiguous
+  // per element tables. The operator can either be assembled into a sparse
+  // matrix or applied matrix-free, using sum factorisation over the tensor
+  // product structure. Elements are processed in parallel (OpenMP) in
+  // colours where no two elements share a basis function, so the results
+  // do not depend on the number of threads.
+  // Vectors of coefficients follow the enumeration of the solution surface
+  // and are scalar. Vector valued solutions are handled one component at
+  // a time.
+  // The tables are not updated if the solution space or the geometry is
+  // changed. Construct a new assembler in that case.
+
+  class SfAssembler
+  {
+  public:
+    // Constructor. Evaluate basis functions and geometry in the Gauss
+    // points of all elements of the solution space
+    SfAssembler(shared_ptr<SfSolution> solution);
+
+    // Constructor. The solution space is given as a spline surface with
+    // the same parameter domain as the geometry surface
+    SfAssembler(shared_ptr<SplineSurface> sol_sf, 
+		shared_ptr<SplineSurface> geom_sf);
+
+    // Destructor
+    ~SfAssembler();
+
+    // Set the coefficients of the bilinear form. Default is diffusion = 1
+    // and reaction = 0 (Laplace operator)
+    void setCoefficients(double diffusion, double reaction);
+
+    // Number of coefficients (unknowns) of the solution space
+    int nmbCoefs() const;
+
+    // Number of elements (non-empty knot intervals)
+    int nmbElements() const;
+
+    // Total number of Gauss points. The Gauss points are ordered element by
+    // element, with the elements in the same order as the coefficients and
+    // the points in an element ordered the same way
+    int nmbGaussPoints() const;
+
+    // Position of the geometry surface in all Gauss points
+    void gaussPoints(std::vector<double>& points) const;
+
+    // Assemble the system matrix. Entries are added to the matrix, which is
+    // resized to nmbCoefs() if necessary
+    void assembleMatrix(SparseMatrix& mat) const;
+
+    // Apply the operator without assembling the matrix, y = A x
+    void apply(const std::vector<double>& x, std::vector<double>& y) const;
+
+    // The diagonal of the system matrix, for preconditioning of matrix-free
+    // iterations
+    void diagonal(std::vector<double>& diag) const;
+
+    // Assemble the load vector (f, v) given the source values f in all
+    // Gauss points, ordered as in gaussPoints()
+    void assembleLoad(const std::vector<double>& source,
+		      std::vector<double>& rhs) const;
+
+  private:
+    // Univariate tables in both parameter directions
+    ElementBasisTable table_[2];
+
+    // Number of coefficients in both parameter directions
+    int ncoef_[2];
+
+    // The geometry surface of the block
+    shared_ptr<SplineSurface> geom_;
+
+    // Geometry factors in the Gauss points, element by element. The
+    // diffusion term uses the inverse of the first fundamental form scaled
+    // by the area element and the Gauss weight, the reaction term the
+    // area element times the Gauss weight
+    std::vector<double> g11_;
+    std::vector<double> g12_;
+    std::vector<double> g22_;
+    std::vector<double> area_;
+
+    // Weights of a rational solution space, with the weight function and
+    // its derivatives in the Gauss points
+    bool rational_;
+    std::vector<double> coef_wgt_;
+    std::vector<double> wgt_;
+    std::vector<double> wgt_u_;
+    std::vector<double> wgt_v_;
+
+    // Elements grouped in colours without shared basis functions
+    std::vector<std::vector<int> > colours_;
+
+    double diffusion_;
+    double reaction_;
+
+    // Build the tables
+    void init(shared_ptr<SplineSurface> sol_sf, 
+	      shared_ptr<SplineSurface> geom_sf);
+
+    // Compute the geometry factors in the Gauss points
+    void computeGeometry();
+
+    // Values and derivatives of all basis functions active in an element,
+    // in one Gauss point. Includes the rational weights
+    void elementBasis(int elem_u, int elem_v, int quad_u, int quad_v,
+		      int quad_ix, double* val, double* der_u,
+		      double* der_v) const;
+
+    // Sum factorised back contraction of values given in the Gauss points
+    // of an element against the derivatives in u, the derivatives in v and
+    // the values of the basis functions. The result is added to y
+    void elementContract(int elem_u, int elem_v, const double* flux_u,
+			 const double* flux_v, const double* src,
+			 double* work, std::vector<double>& y) const;
+  };
+
+} // end namespace Go
+
+
+#endif    // #ifndef __SFASSEMBLER_H
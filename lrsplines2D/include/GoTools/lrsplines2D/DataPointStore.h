@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _DATAPOINTSTORE_H
+#define _DATAPOINTSTORE_H
+
+#include <vector>
+#include <list>
+#include <string>
+#include <cstdio>
+#include <cstddef>
+
+namespace Go
+{
+
+// =============================================================================
+/// Out-of-core storage of the scattered data points kept in the elements of
+/// an LR spline surface during approximation, see LRSurfApprox. The point
+/// arrays of the elements are registered with the store. When the memory
+/// used by the arrays exceeds a given limit, arrays are written to a
+/// temporary file and freed, least recently used first. An array is read
+/// back when the element accesses its points.
+///
+/// An array is in use from the moment its points are accessed until the
+/// element releases it. Only arrays which are not in use are written to
+/// file, thus references to the points stay valid while they are used.
+/// Points may be appended to an array that is written to file without
+/// reading it back, so a point cloud may be distributed to the elements
+/// in chunks without ever being in memory as a whole.
+/// The contents and ordering of the points are kept, so the result of
+/// the approximation is not affected. All functions may be called from
+/// several threads.
+class DataPointStore
+// =============================================================================
+{
+ public:
+  /// Constructor
+  /// \param max_bytes limit for the memory used by point arrays which
+  ///        are not in use
+  /// \param directory where to put the temporary file. If empty, the
+  ///        default directory for temporary files is used
+  DataPointStore(size_t max_bytes, 
+		 const std::string& directory = std::string());
+
+  /// Destructor. Removes the temporary file
+  ~DataPointStore();
+
+  /// Register a point array. The array is considered to be in use.
+  /// Returns the identifier of the array in the store
+  int add(std::vector<double>* points);
+
+  /// Unregister a point array
+  void remove(int id);
+
+  /// Make sure the points are in memory and mark the array as in use
+  void pin(int id);
+
+  /// Mark the array as not in use. Arrays may be written to file if
+  /// the memory limit is exceeded
+  void release(int id);
+
+  /// Mark all arrays as not in use, and reduce the memory use to the
+  /// limit
+  void releaseAll();
+
+  /// Append values to an array. If the array is written to file, the
+  /// values are written to file too and the array stays on file
+  void append(int id, const double* values, size_t nmb);
+
+  /// Number of values in the array, also when it is written to file
+  size_t size(int id) const;
+
+  /// Memory limit
+  size_t maxBytes() const
+  {
+    return max_bytes_;
+  }
+
+  /// Memory used by the arrays which are in memory and not in use
+  size_t residentBytes() const
+  {
+    return resident_bytes_;
+  }
+
+  /// Largest memory used by the registered arrays, in use or not, since
+  /// the store was created. Arrays changed directly while they are in
+  /// use are accounted for when they are released
+  size_t peakMemoryBytes() const
+  {
+    return peak_bytes_;
+  }
+
+  /// Number of times an array is written to file
+  int numPageOut() const
+  {
+    return nmb_page_out_;
+  }
+
+  /// Number of times an array is read from file
+  int numPageIn() const
+  {
+    return nmb_page_in_;
+  }
+
+ private:
+  struct Entry
+  {
+    std::vector<double>* points;
+    long long offset;    // Position in file, counted in doubles
+    size_t capacity;     // Room in file, counted in doubles
+    size_t size;         // Number of values, valid if paged out
+    size_t pinned_size;  // Number of values when the array was pinned
+    bool paged_out;
+    bool in_use;
+    std::list<int>::iterator lru;  // Position in lru_ if not in use
+  };
+
+  size_t max_bytes_;
+  size_t resident_bytes_;
+  size_t in_use_bytes_;  // Memory of the arrays in use, as known
+  size_t peak_bytes_;
+  std::vector<Entry> entries_;
+  std::vector<int> free_ids_;
+  std::list<int> lru_;   // Resident arrays not in use, least
+                         // recently used first
+  std::string directory_;
+  FILE* file_;
+  long long file_end_;   // Counted in doubles
+  long long garbage_;    // Unused room in the file, counted in doubles
+  int nmb_page_out_;
+  int nmb_page_in_;
+
+  void pageOut(int id);
+  void pageIn(int id);
+  void unpin(int id);
+  void enforceLimit();
+  void updatePeak();
+  void appendToFile(int id, const double* values, size_t nmb);
+  void openFile();
+  void compactFile();
+
+  // Not copyable
+  DataPointStore(const DataPointStore&);
+  DataPointStore& operator=(const DataPointStore&);
+};
+
+} // end namespace Go
+
+#endif // _DATAPOINTSTORE_H
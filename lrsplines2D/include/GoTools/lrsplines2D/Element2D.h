@@ -43,6 +43,7 @@
 #include <vector>
 #include "GoTools/utils/config.h"
 #include "GoTools/lrsplines2D/Direction2D.h"
+#include "GoTools/lrsplines2D/DataPointStore.h"
 #include "GoTools/geometry/SplineCurve.h"
 
 namespace Go {
@@ -60,26 +61,67 @@ struct LSSmoothData
     nmb_outside_tol_ = -1;
     minheight_ = std::numeric_limits<double>::max();
     maxheight_ = std::numeric_limits<double>::lowest();
+    store_id_ = -1;
+    accuracy_valid_ = false;
+  }
+
+  ~LSSmoothData()
+  {
+    if (store_.get())
+      store_->remove(store_id_);
+  }
+
+  /// Let the data points be kept in an out-of-core store
+  void setDataPointStore(shared_ptr<DataPointStore> store)
+  {
+    if (store_.get() || !store.get())
+      return;
+    store_ = store;
+    store_id_ = store_->add(&data_points_);
+  }
+
+  shared_ptr<DataPointStore> getDataPointStore() const
+  {
+    return store_;
+  }
+
+  /// Make sure that the data points are in memory. Called by all
+  /// functions accessing data_points_
+  void pinDataPoints()
+  {
+    if (store_.get())
+      store_->pin(store_id_);
+  }
+
+  /// Tell that the data points are not used for now. They may be
+  /// written to file by the store
+  void releaseDataPoints()
+  {
+    if (store_.get())
+      store_->release(store_id_);
   }
 
   bool hasDataPoints()
   {
-    return (data_points_.size() > 0);
+    return (dataPointSize() > 0);
   }
 
   void eraseDataPoints()
   {
+    pinDataPoints();
     data_points_.clear();
   }
 
   void eraseGhostPoints()
   {
     ghost_points_.clear();
+    accuracy_valid_ = false;
   }
 
   void eraseDataPoints(std::vector<double>::iterator start, 
 		       std::vector<double>::iterator end)
   {
+    pinDataPoints();
     data_points_.erase(start, end);
   }
 
@@ -87,7 +129,15 @@ struct LSSmoothData
 		     std::vector<double>::iterator end,
 		     bool sort_in_u, int del=0)
   {
-    data_points_.insert(data_points_.end(), start, end);
+    // With a store, the points are appended also to an array on file
+    if (store_.get())
+      {
+	if (start != end)
+	  store_->append(store_id_, &(*start), end - start);
+      }
+    else
+      data_points_.insert(data_points_.end(), start, end);
+    accuracy_valid_ = false;
     sort_in_u_ = sort_in_u;
     if (pt_del_ == 0)
       pt_del_ = del;
@@ -98,13 +148,18 @@ struct LSSmoothData
 		     int del, bool sort_in_u, 
 		     bool prepare_outlier_detection)
   {
+    std::vector<double> tmp;
+    std::vector<double>& points = (store_.get()) ? tmp : data_points_;
     for (std::vector<double>::iterator curr=start; curr!= end; curr+=del)
       {
-	data_points_.insert(data_points_.end(), curr, curr+del);
-	data_points_.push_back(0.0);
+	points.insert(points.end(), curr, curr+del);
+	points.push_back(0.0);
 	if (prepare_outlier_detection)
-	  data_points_.push_back(1.0);
+	  points.push_back(1.0);
       }
+    if (store_.get() && tmp.size() > 0)
+      store_->append(store_id_, &tmp[0], tmp.size());
+    accuracy_valid_ = false;
     sort_in_u_ = sort_in_u;
     if (pt_del_ == 0)
       pt_del_ = del+1+(prepare_outlier_detection);
@@ -115,6 +170,7 @@ struct LSSmoothData
 		      bool sort_in_u, int del=0)
   {
     ghost_points_.insert(ghost_points_.end(), start, end);
+    accuracy_valid_ = false;
     sort_in_u_ = sort_in_u;
     if (pt_del_ == 0)
       pt_del_ = del;
@@ -132,6 +188,7 @@ struct LSSmoothData
 	if (prepare_outlier_detection)
 	  ghost_points_.push_back(1.0);
       }
+    accuracy_valid_ = false;
     sort_in_u_ghost_ = sort_in_u;
     if (pt_del_ == 0)
       pt_del_ = del+1+(prepare_outlier_detection);
@@ -144,6 +201,7 @@ struct LSSmoothData
 
    std::vector<double>& getDataPoints()
   {
+   pinDataPoints();
    return data_points_;
   }
 
@@ -162,6 +220,8 @@ struct LSSmoothData
   
   int dataPointSize()
   {
+    if (store_.get())
+      return (int)store_->size(store_id_);
     return (int)data_points_.size();
   }
 
@@ -266,6 +326,7 @@ struct LSSmoothData
       return;  // No outlier information
     int ix1 = (pt_del_ <= 5) ? 0 : 2;   // Distinguishes between 1D and 3D case
     int ix2 = ix1 + 3;
+    pinDataPoints();
     for (std::vector<double>::iterator it=data_points_.begin(); 
 	 it != data_points_.end(); it+=pt_del_)
       {
@@ -280,6 +341,7 @@ struct LSSmoothData
       return;  // No outlier information
     int ix1 = (pt_del_ <= 5) ? 0 : 2;   // Distinguishes between 1D and 3D case
     int ix2 = ix1 + 3;
+    pinDataPoints();
     for (std::vector<double>::iterator it=data_points_.begin(); 
 	 it != data_points_.end(); it+=pt_del_)
       {
@@ -295,6 +357,7 @@ struct LSSmoothData
       return;  // No outlier information
     int ix1 = (pt_del_ <= 5) ? 0 : 2;   // Distinguishes between 1D and 3D case
     int ix2 = ix1 + 3;
+    pinDataPoints();
     for (std::vector<double>::iterator it=data_points_.begin(); 
 	 it != data_points_.end(); it+=pt_del_)
       {
@@ -307,6 +370,20 @@ struct LSSmoothData
 
   bool getDataBoundingBox(int dim, double bb[]);
 
+  /// The distances stored in the points are computed with the given
+  /// support functions and their current coefficients
+  void setAccuracyUpToDate(const std::vector<LRBSpline2D*>& support);
+
+  /// Check if the distances stored in the points are still valid, i.e.
+  /// that the coefficients of the support functions are unchanged and
+  /// that no points are added since the last call to setAccuracyUpToDate
+  bool accuracyUpToDate(const std::vector<LRBSpline2D*>& support) const;
+
+  void setAccuracyOutdated()
+  {
+    accuracy_valid_ = false;
+  }
+
   void makeDataPoints3D(int dim);
 
   void updateAccuracyInfo(int dim);
@@ -333,7 +410,17 @@ struct LSSmoothData
   int nmb_outside_tol_;
   double accumulated_out_;
   double minheight_;
+  shared_ptr<DataPointStore> store_;  // Out-of-core storage of data_points_
+  int store_id_;
   double maxheight_;
+  bool accuracy_valid_;
+  std::vector<double> accuracy_coefs_;  // Coefficients times gamma of the
+  // support functions when the distances were computed
+
+ private:
+  // Not copyable, the store refers to data_points_
+  LSSmoothData(const LSSmoothData&);
+  LSSmoothData& operator=(const LSSmoothData&);
 };
 
 
@@ -363,6 +450,13 @@ public:
 	{
 	  return support_;
 	}
+	// Set all support functions at once. No test for duplicates is
+	// performed
+	void setSupport(const std::vector<LRBSpline2D*>& support)
+	{
+	  support_ = support;
+	  setAccuracyOutdated();
+	}
 	/* std::vector<LRBSpline2D*> getSupport()  */
 	/* { */
 	/*   return support_; */
@@ -420,6 +514,36 @@ public:
 	/// Number of ghost points
 	int nmbGhostPoints();
 
+	/// Let the data points associated with the element be kept in
+	/// an out-of-core store. Points added later are kept in the
+	/// same store
+	void setDataPointStore(shared_ptr<DataPointStore> store)
+	{
+	  if (!store.get())
+	    return;
+	  if (!LSdata_)
+	    LSdata_ = shared_ptr<LSSmoothData>(new LSSmoothData());
+	  LSdata_->setDataPointStore(store);
+	}
+
+	/// The out-of-core store of the data points, if any
+	shared_ptr<DataPointStore> getDataPointStore() const
+	{
+	  return LSdata_.get() ? LSdata_->getDataPointStore() :
+	    shared_ptr<DataPointStore>();
+	}
+
+	/// Tell that the data points of the element are not used for
+	/// now, i.e. that no references to the points returned by
+	/// getDataPoints() are kept. If an out-of-core store is used,
+	/// the points may be written to file, and they are read back
+	/// when accessed again
+	void releaseDataPoints()
+	{
+	  if (LSdata_.get())
+	    LSdata_->releaseDataPoints();
+	}
+
 	/// Remove data points associated with the element
 	void eraseDataPoints()
 	{
@@ -678,6 +802,32 @@ public:
 	  is_modified_ = true;
 	}
 
+	/// Register that the distances stored in the data points are
+	/// computed with the current surface
+	void setAccuracyUpToDate()
+	{
+	  if (LSdata_.get())
+	    LSdata_->setAccuracyUpToDate(support_);
+	}
+
+	/// Check if the distances stored in the data points are computed
+	/// with the current surface, i.e. the support is not changed and
+	/// the coefficients of the support functions are the same
+	bool accuracyUpToDate() const
+	{
+	  if (LSdata_.get())
+	    return LSdata_->accuracyUpToDate(support_);
+	  else
+	    return false;
+	}
+
+	/// The distances stored in the data points must be recomputed
+	void setAccuracyOutdated()
+	{
+	  if (LSdata_.get())
+	    LSdata_->setAccuracyOutdated();
+	}
+
 	// DEBUG
 	double sumOfScaledBsplines(double upar, double vpar);
 
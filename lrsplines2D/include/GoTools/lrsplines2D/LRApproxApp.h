@@ -85,6 +85,27 @@ namespace Go
 			   double& avdist_out, int& nmb_out,
 			   int mba=1, int tomba=0);
 
+    /// Approximate a large point cloud (x, y, height) by a collection of
+    /// LR B-spline surfaces organized in a regular grid of nmb_u times
+    /// nmb_v tiles covering domain (umin, umax, vmin, vmax). Each tile is
+    /// approximated by pointCloud2Spline using the points inside the
+    /// tile extended by overlap (relative to the tile size) in all
+    /// directions, and then restricted to the tile. The tiles are 
+    /// approximated in parallel and finally stitched with LRSurfStitch
+    /// to obtain continuity cont (0 or 1). 
+    /// The surfaces are organized from bottom to top and from left to 
+    /// right as expected by LRSurfStitch. Tiles without points are 
+    /// returned as empty pointers. The accuracy information is collected
+    /// from the tile approximations prior to stitching.
+    void tiledPointCloud2Spline(std::vector<double>& points, 
+				double domain[], int nmb_u, int nmb_v,
+				double overlap, double eps, int max_iter,
+				int cont,
+				std::vector<shared_ptr<LRSplineSurface> >& surfs,
+				double& maxdist, double& avdist, 
+				int& nmb_out, int mba=0, int initmba=1, 
+				int tomba=5);
+
     /// Compute point cloud distance with respect to an LR B-spline surface
     void computeDistPointSpline(std::vector<double>& points,
 				shared_ptr<LRSplineSurface>& surf,
@@ -102,6 +123,17 @@ namespace Go
 				     std::vector<double>& pointsdist,
 				    int use_proj = 0);
 
+    /// Compute point cloud distance with respect to an LR B-spline surface
+    /// Multi-threaded version working directly on a point buffer, i.e.
+    /// a memory mapped point file (see PointCloudIO::MappedPoints).
+    /// The points (u, v, height) are sorted in place
+    void computeDistPointSpline_omp(double* points, int nmb_pts,
+				    shared_ptr<LRSplineSurface>& surf,
+				    double& max_above, double& max_below, 
+				    double& avdist, int& nmb_points,
+				    std::vector<double>& pointsdist,
+				    int use_proj = 0);
+
     /// Compute point cloud distance with respect to an LR B-spline surface
     /// and group points according to this distances
     void classifyCloudFromDist(std::vector<double>& points,
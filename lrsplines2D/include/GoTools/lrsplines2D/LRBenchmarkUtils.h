@@ -51,6 +51,20 @@ namespace Go
 				 const std::vector<LRSplineSurface::Refinement2D>& refs,
 				 bool single_insertions = false);
 
+    /// Time one MBA update (LRSplineMBA::MBADistAndUpdate_omp) of the
+    /// surface using the data points stored in its elements. If OpenMP is
+    /// enabled, the update is run with num_threads threads.
+    /// Returns the time spent in seconds.
+    double benchmarkMBAUpdate(LRSplineSurface& lr_sf, int num_threads);
+
+    /// Evaluate the surface at the parameter values given sequentially
+    /// as (u,v) pairs in par. No element hints are given, each point is
+    /// evaluated by LRSplineSurface::point(). The positions are returned
+    /// in pts. Returns the time spent in seconds.
+    double benchmarkPointEvaluation(const LRSplineSurface& lr_sf,
+				    const std::vector<double>& par,
+				    std::vector<double>& pts);
+
 }
 
 #endif // _LRBENCHMARKUTILS_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRELEMENTGRID_H
+#define _LRELEMENTGRID_H
+
+#include "GoTools/lrsplines2D/Mesh2D.h"
+#include "GoTools/lrsplines2D/Element2D.h"
+
+#include <vector>
+
+namespace Go
+{
+
+// =============================================================================
+/// A uniform grid of buckets covering the parameter domain of an LR mesh.
+/// Each bucket stores the elements overlapping it, thus the element
+/// containing a parameter value is found by computing the bucket index and
+/// testing a few candidates. The number of buckets is chosen from the
+/// number of elements and the number of knot intervals in each direction.
+///
+/// The grid does not own the elements. Elements that are added or enlarged
+/// after the grid is built must be registered with insert(). Elements that
+/// only shrink may stay registered in buckets they do not overlap any
+/// longer, while elements that are deleted require a new build.
+class LRElementGrid
+// =============================================================================
+{
+ public:
+  /// Constructor. Creates an empty grid
+  LRElementGrid();
+
+  /// Build the grid for the given elements of the mesh
+  void build(const Mesh2D& mesh, const std::vector<Element2D*>& elements);
+
+  /// Register an element which is added after the grid was built
+  void insert(Element2D* elem);
+
+  /// Remove all buckets
+  void clear();
+
+  /// Check if the grid is built
+  bool empty() const
+  {
+    return buckets_.empty();
+  }
+
+  /// Number of elements when the grid was built
+  int numBuilt() const
+  {
+    return nmb_built_;
+  }
+
+  /// Number of elements registered in the grid, including the elements
+  /// inserted after it was built
+  int numRegistered() const
+  {
+    return nmb_registered_;
+  }
+
+  /// Find the element containing the parameter value (u,v). Elements are
+  /// closed downwards and open upwards except at the upper boundaries of
+  /// the domain, the same convention as in
+  /// Mesh2DUtils::identify_patch_lower_left(). Returns NULL if the value
+  /// is outside the domain.
+  Element2D* element(double u, double v) const;
+
+ private:
+  double umin_, umax_, vmin_, vmax_;
+  int nmb_u_, nmb_v_;     // Number of buckets in each direction
+  double ufac_, vfac_;    // Number of buckets per unit parameter interval
+  int nmb_built_;
+  int nmb_registered_;
+  std::vector<std::vector<Element2D*> > buckets_;  // Buckets stored
+                                                   // sequentially in u
+
+  int bucketIndex(double par, double start, double fac, int nmb) const
+  {
+    int ix = (int)((par - start)*fac);
+    return (ix < 0) ? 0 : ((ix >= nmb) ? nmb-1 : ix);
+  }
+};
+
+} // end namespace Go
+
+#endif // _LRELEMENTGRID_H
@@ -142,7 +142,7 @@ public:
 
   int numElements() const
     {
-      return elements_.size();
+      return (int)elements_.size();
     }
 
   int dim() const
@@ -183,7 +183,7 @@ public:
     // Copy and paste from code in r2gl.
     void testCoefComputation();
 
-    inline void computeBezCoefs(int dim, const double *points, int orderU, int orderV, double *coefs)
+    static void computeBezCoefs(int dim, const double *points, int orderU, int orderV, double *coefs)
 	{
 	    if ((orderU != 3 && orderU != 4) || (orderV != 3 && orderV != 4)) {
 		throw std::runtime_error("LRViz only supports quadratic and cubic surfs");
@@ -202,7 +202,6 @@ public:
 		    2/6.0, -9/6.0, 18/6.0, -5/6.0,
 		    0, 0, 0, 1
 		};
-	    double *p;
 	    if (orderU == 3) {
 		for(int row=0; row<orderV; row++) {
 		    for(int i=0; i<dim; i++) {
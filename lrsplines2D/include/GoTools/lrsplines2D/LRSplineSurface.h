@@ -55,6 +55,7 @@
 #include "GoTools/lrsplines2D/BSplineUniLR.h"
 #include "GoTools/lrsplines2D/LRBSpline2D.h"
 #include "GoTools/lrsplines2D/Element2D.h"
+#include "GoTools/lrsplines2D/LRElementGrid.h"
 
 namespace Go
 {
@@ -218,6 +219,13 @@ namespace Go
   virtual void  read(std::istream& is);       
   virtual void write(std::ostream& os) const; 
 
+  // Binary g2 format (see G2BinaryFile). The univariate B-splines are
+  // stored once, and referred to by index from the LR B-splines. The
+  // element to B-spline incidences are stored as well, so no searching
+  // is needed when reading
+  virtual void readBinary(BinaryReader& is);
+  virtual void writeBinary(BinaryWriter& os) const;
+
   // ----------------------------------------------------
   // Inherited from GeomObject
   // ----------------------------------------------------
@@ -321,12 +329,31 @@ namespace Go
     /// Evaluate points in a grid
     /// The nodata value is applicable for bounded surfaces
     /// and will not be used in this context
+    /// Non-rational surfaces of degree 2 or 3 are evaluated element by
+    /// element from the Bezier representation of each element, otherwise
+    /// the points are evaluated one by one.
     virtual void evalGrid(int num_u, int num_v, 
 			  double umin, double umax, 
 			  double vmin, double vmax,
 			  std::vector<double>& points,
 			  double nodata_val = -9999) const;
 
+    /// Evaluate the surface in a set of parameter values. The values are
+    /// grouped by element. For non-rational surfaces of degree 2 or 3
+    /// each element is converted to Bezier form once, and the points in
+    /// the element are evaluated from the Bezier coefficients. The elements
+    /// are processed in parallel when OpenMP is enabled.
+    /// \param params parameter pairs (u,v), parameter values outside the
+    /// domain are moved to the boundary
+    /// \param points the surface points, dimension() values for each
+    /// parameter pair in the sequence of the parameter pairs
+    void evalPoints(const std::vector<double>& params,
+		    std::vector<double>& points) const;
+
+    /// Check if evalGrid() and evalPoints() apply the Bezier 
+    /// representation of the elements
+    bool bezierEvaluation() const;
+
     /// Get the start value for the u-parameter
     /// \return the start value for the u-parameter
     virtual double startparam_u() const;
@@ -547,6 +574,13 @@ namespace Go
   // The construction can speed up evaluation in many points by making
   // it possible to avoid searching of the correct element
   void constructElementMesh(std::vector<Element2D*>& elements) const;
+
+  // Grid evaluation using the Bezier representation of the elements,
+  // see evalGrid()
+  void evalGridBezier(int num_u, int num_v, 
+		      double umin, double umax, 
+		      double vmin, double vmax,
+		      std::vector<double>& points) const;
  
   // Returns pointers to all basis functions whose support covers the parametric point (u, v). 
   // (NB: ownership of the pointed-to LRBSpline2Ds is retained by the LRSplineSurface.)
@@ -663,6 +697,18 @@ namespace Go
     curr_element_ = curr_el;
   }
 
+  // Use a bucketed grid over the parameter domain to locate the element
+  // containing a parameter value. This speeds up evaluation at scattered
+  // parameter values where the previous element is of no help. The grid is
+  // kept up to date when the elements change.
+  void setElementGrid(bool use_grid);
+
+  // Check if the element grid is in use
+  bool hasElementGrid() const
+  {
+    return !elem_grid_.empty();
+  }
+
   // ----------------------------------------------------
   // --------------- DEBUG FUNCTIONS --------------------
   // ----------------------------------------------------
@@ -707,6 +753,7 @@ namespace Go
   // Generated data
   mutable RectDomain domain_;
   mutable Element2D* curr_element_;
+  LRElementGrid elem_grid_;   // Empty if not in use
 
   // Private constructor given mesh and a collection of LR B-splines
   // Updates mesh pointers in B-splines
@@ -724,6 +771,9 @@ namespace Go
   // Locate all elements in a mesh
   static ElementMap construct_element_map_(const Mesh2D&, const BSplineMap&);
 
+  // Rebuild the element grid if it is in use
+  void update_element_grid_();
+
   // Collect all LR B-splines overlapping a specified area
 //    std::vector<std::unique_ptr<LRBSpline2D> > 
     std::vector<LRBSpline2D*> 
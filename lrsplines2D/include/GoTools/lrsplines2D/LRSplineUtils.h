@@ -58,6 +58,10 @@
 
 namespace Go
 {
+  namespace PointCloudIO
+  {
+    class PointChunkReader;
+  }
 
   namespace LRSplineUtils
   {
@@ -142,6 +146,10 @@ namespace Go
     void split_univariate(std::vector<std::unique_ptr<BSplineUniLR> >& bsplines,
 			  int& last, int fixed_ix, int mult);
 
+    // Remove the univariate B-splines which are not referred to by any
+    // bivariate B-spline. The sequence of the remaining B-splines is kept.
+    void remove_unused_univariate(std::vector<std::unique_ptr<BSplineUniLR> >& bsplines);
+
     bool elementOK(const Element2D* elem, const Mesh2D& m);
 
     // Lifts a one-dimensional LR-spline function to a three-dimensional function by adding the
@@ -167,6 +175,17 @@ namespace Go
 			      bool primary_points = true,
 			      bool outlier_flag = false);
 
+    // Distribute the data points of a file to the elements, reading at
+    // most chunk_size points at the time. The elements keep their
+    // points in the store, which may be empty, and the arrays are
+    // written to file while the points are distributed. A distance
+    // field is added to the points. Returns the number of points
+    long long distributeDataPoints(LRSplineSurface* srf, 
+				   PointCloudIO::PointChunkReader& reader,
+				   long long chunk_size,
+				   shared_ptr<DataPointStore> store,
+				   bool outlier_flag = false);
+
     void evalAllBSplines(const std::vector<LRBSpline2D*>& bsplines,
 			 double upar, double vpar, 
 			 bool u_at_end, bool v_at_end, 
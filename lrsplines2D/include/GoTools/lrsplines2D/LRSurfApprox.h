@@ -44,6 +44,7 @@
 #include "GoTools/creators/Eval1D3DSurf.h"
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/LRSurfSmoothLS.h"
+#include "GoTools/lrsplines2D/DataPointStore.h"
 #include <vector>
 
 
@@ -52,6 +53,11 @@
 
 namespace Go
 {
+namespace PointCloudIO
+{
+  class PointChunkReader;
+}
+
 /// This class can generate a LR B-spline surface that approximates
 /// a set of points for a given accuracy.
 
@@ -378,6 +384,46 @@ class LRSurfApprox
       verbose_ = verbose;
     }
 
+    /// Limit the memory used for the data points stored in the surface
+    /// elements. Point arrays not in use are paged out to a temporary
+    /// spill file in the given directory (system default if empty) when
+    /// the resident size exceeds max_bytes, also while the points are
+    /// distributed to the elements. The approximation result is not
+    /// affected. The input point vector is emptied when the points are
+    /// distributed. Use distributePointChunks() to avoid having the
+    /// input points in memory at all.
+    void setPointMemoryLimit(size_t max_bytes,
+			     const std::string& spill_dir = std::string())
+    {
+      point_store_ = 
+	shared_ptr<DataPointStore>(new DataPointStore(max_bytes, spill_dir));
+    }
+
+    /// Preconditioner used when solving the least squares equation
+    /// system, see LRSurfSmoothLS::setPreconditioner. Default is RILU
+    /// with relaxation parameter 0.1
+    void setLSPreconditioner(int precond, double relaxfac)
+    {
+      ls_precond_ = precond;
+      ls_relaxfac_ = relaxfac;
+    }
+
+    /// Distribute the points of a file to the elements of the surface,
+    /// reading at most chunk_size points at the time. The points are
+    /// kept in the store given by setPointMemoryLimit(), thus the point
+    /// cloud is never in memory as a whole. To be used with a
+    /// constructor taking an initial LR spline surface and an empty
+    /// point vector. Outlier detection must be set in advance.
+    /// The points are not reparameterized
+    void distributePointChunks(PointCloudIO::PointChunkReader& reader,
+			       long long chunk_size);
+
+    /// Store holding element data points when a memory limit is set
+    shared_ptr<DataPointStore> getPointStore() const
+    {
+      return point_store_;
+    }
+
     /// When everything else is set, this function can be used to run the 
     /// approximation process and fetch the approximated surface.
     /// \retval maxdist report the maximum distance between the approximated 
@@ -432,9 +478,16 @@ class LRSurfApprox
     int outsideeps_;
     double maxout_;
     double avout_;
+    // Work done in the last accuracy computation. Elements where the
+    // surface is unchanged reuse the distances stored in the points
+    int nmb_elem_computed_;
+    int nmb_elem_reused_;
+    int nmb_pts_computed_;
     double aepsge_;
     double smoothweight_;
     int maxLScoef_;
+    int ls_precond_;      // Preconditioner in least squares approximation
+    double ls_relaxfac_;
     bool smoothbd_;
     bool repar_;
     bool check_close_;
@@ -455,6 +508,8 @@ class LRSurfApprox
     int nmb_mba_iter_;
     int mba_sgn_;
     bool verbose_;
+    shared_ptr<DataPointStore> point_store_;  // Out-of-core storage of 
+    // element data points, empty if no memory limit is set
     double usize_min_;  // Minimum element size in u direction, negative 
     // if not set
     double vsize_min_;  // Minimum element size in v direction, negative 
@@ -58,6 +58,7 @@
 #include <vector>
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/LRBSpline2D.h"
+#include "GoTools/creators/SparseMatrix.h"
 
 namespace Go
 {
@@ -132,6 +133,18 @@ class LRSurfSmoothLS
   ///               weight should lie in the unit interval.
   void setLeastSquares(std::vector<double>& points, const double weight);
 
+  /// Select the preconditioner used when solving the equation system.
+  /// The equation systems for all coordinates are solved simultaneously.
+  /// \param precond 0 = none, 1 = RILU (default), 2 = Jacobi, 3 = SSOR,
+  /// 4 = incomplete Cholesky. See SolveCG::Preconditioner.
+  /// \param relaxfac relaxation parameter for RILU (default 0.1, range
+  /// [0.0, 1.0]) and SSOR (range <0.0, 2.0>).
+  void setPreconditioner(int precond, double relaxfac)
+  {
+    precond_ = precond;
+    relaxfac_ = relaxfac;
+  }
+
   /// Solve equation system, and produce output surface.
   /// If failing to solve the routine may throw an exception.
   /// \param surf the output surface.
@@ -144,12 +157,30 @@ class LRSurfSmoothLS
   int ncond_;                        // Number of unknown coefficients
 
   /// Storage of the equation system.
-  std::vector<double> gmat_;         // Matrix at left side of equation system.  
+  SparseMatrix gmat_;                // Matrix at left side of equation system.
+                                     // Only entries corresponding to pairs of
+                                     // B-splines with overlapping support are stored
   std::vector<double> gright_;       // Right side of equation system.      
  
   BsplineIndexMap BSmap_;   // Indices to all LR B-splines to associate
                             // a posistion in the stiffness matrix
 
+  int precond_;             // Preconditioner, see setPreconditioner()
+  double relaxfac_;         // Relaxation parameter of the preconditioner
+
+  // Group the elements such that elements in the same group have no
+  // free LR B-spline in common. The contributions of the elements in
+  // one group to the equation system may be added concurrently
+  void colourElements(std::vector<std::vector<Element2D*> >& colours) const;
+
+  // Add the least squares contributions of one element to the 
+  // equation system
+  void assembleLeastSquares(Element2D* elem, double weight);
+
+  // Compute and add the smoothing term contributions of one element
+  void elementSmoothing(Element2D* elem, int der1, int der2, int der3,
+			double weight1, double weight2, double weight3);
+
   // Compute the least squares contributions to the stiffness matrix and
   // the right hand side for a specified set of B-splines
   void localLeastSquares(std::vector<double>& points, 
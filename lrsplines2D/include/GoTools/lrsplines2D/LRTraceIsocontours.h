@@ -22,6 +22,9 @@ namespace Go
   // 'traceIsovals' to march out the curves.  If desired, SISL routine s1314 can
   // be used instead by setting 'use_sisl_marching' to true.  The SISL routine
   // is slower, but likely more robust.  
+  // The surface is split into simpler patches, and each patch is only traced
+  // for the levels within the range of its coefficients, found by an interval
+  // tree.  With OpenMP, patches are traced and levels merged in parallel. 
   std::vector<CurveVec> LRTraceIsocontours(const shared_ptr<ParamSurface>& surf,
 					   const std::vector<double>& isovals,
 					   const int threshold_missing,
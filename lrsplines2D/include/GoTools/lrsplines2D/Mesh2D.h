@@ -94,6 +94,12 @@ public:
   // Write the mesh to a stream
   virtual void write(std::ostream& os) const; 
 
+  // Read the mesh from a binary g2 stream
+  virtual void readBinary(BinaryReader& is);
+
+  // Write the mesh to a binary g2 stream
+  virtual void writeBinary(BinaryWriter& os) const;
+
   // Swap two meshes
   void swap(Mesh2D& rhs);             
 
@@ -21,7 +21,9 @@ namespace Go
   // purposes in a 3D viewer.  By default, the function employs the function
   // 'traceIsovals' to march out the curves.  If desired, SISL routine s1314 can
   // be used instead by setting 'use_sisl_marching' to true.  The SISL routine
-  // is slower, but likely more robust.
+  // is slower, but likely more robust.  Levels outside the range of the
+  // coefficients are skipped, and with OpenMP the levels are traced in 
+  // parallel unless called from within a parallel region.
   std::vector<CurveVec> SSurfTraceIsocontours(const SplineSurface& ss,
 					      const std::vector<double>& isovals,
 					      const double tol = 1e-6,
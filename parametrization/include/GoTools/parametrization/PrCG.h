@@ -42,11 +42,15 @@
 
 #include "GoTools/parametrization/PrMatrix.h"
 #include "GoTools/parametrization/PrVec.h"
+#include "GoTools/parametrization/PrPreconditioner.h"
 
 /*<PrCG-syntax: */
 
-/** PrCG - This class implements the (unpreconditioned) CG method
+/** PrCG - This class implements the preconditioned CG method
  * for solving sparse symmetric positive definite linear systems.
+ * Two systems with the same matrix can be solved simultaneously.
+ * Vector operations and sparse matrix products are parallelized
+ * with OpenMP for large systems.
  */
 class PrCG
 {
@@ -54,11 +58,19 @@ protected:
 
   double tolerance_;
   int max_iterations_;
+  PrPrecondType precond_type_;
 
   int it_count_;
   double cpu_time_;
   bool converged_;
 
+  void solveSystems(const PrMatrix& A, PrVec* x[], const PrVec* b[],
+		    int nmb);
+  static void prodActive(const PrMatrix& A, PrVec* in[], PrVec out[],
+			 const bool active[], int nmb);
+  static void applyPrecond(const PrPreconditioner& precond, PrVec r[],
+			   PrVec z[], const bool active[], int nmb);
+
 public:
   /// Constructor
   PrCG();
@@ -70,8 +82,18 @@ public:
   /// Set the maximum number of iterations.
   void setMaxIterations(int max_iterations)
            {max_iterations_ = max_iterations;}
+  /// Set the preconditioner. The default is no preconditioning.
+  /// The preconditioner must be symmetric, i.e. ILU(0) only for
+  /// structurally and numerically symmetric matrices.
+  void setPreconditioner(PrPrecondType precond_type = PrNOPRECOND)
+           {precond_type_ = precond_type;}
   ///Solve the linear system, replacing the start vector with the solution.
   void solve(const PrMatrix& A, PrVec& x, const PrVec& b);
+  /// Solve two linear systems with the same matrix simultaneously,
+  /// replacing the start vectors with the solutions. The iteration
+  /// count is the one of the slowest system.
+  void solve(const PrMatrix& A, PrVec& x1, const PrVec& b1,
+	     PrVec& x2, const PrVec& b2);
 
   /// Get the number of iterations spent for the last call of 'solve()'.
   int getItCount() {return it_count_; }
@@ -90,7 +112,7 @@ public:
 Name:              PrCG
 Syntax:	           @PrCG-syntax
 Keywords:
-Description:       This class implements the (unpreconditioned) CG method
+Description:       This class implements the preconditioned CG method
                    for solving sparse symmetric positive definite
                    linear systems.
 Member functions:
@@ -100,6 +122,10 @@ Member functions:
                    "setMaxIterations()" --\\
                    Set the maximum number of iterations.
 
+                   "setPreconditioner()" --\\
+                   Set the preconditioner, PrNOPRECOND, PrJACOBI
+                   or PrILU0.
+
                    "solve(const PrMatrix& A, PrVec& x, const PrVec& b)" --\\
                    Solve the linear system, replacing the start vector
                    with the solution.
@@ -66,6 +66,9 @@ public:
   virtual double operator () (int i, int j) const;
   /// Find y = Ax
   virtual void prod(const PrVec& x, PrVec& y) const;
+  /// Find y1 = Ax1 and y2 = Ax2 in one pass through the matrix
+  virtual void prodPair(const PrVec& x1, const PrVec& x2,
+			PrVec& y1, PrVec& y2) const;
   virtual void print(std::ostream& os);
   virtual void read(std::istream& is);
   /// virtual destructor
@@ -59,6 +59,11 @@ public:
   virtual double operator () (int i, int j) const = 0;
   /// Multiply matrix with 'x' and return result in 'y'.  (y = Ax)
   virtual void prod(const PrVec& x, PrVec& y) const = 0;
+  /// Multiply matrix with two vectors, y1 = Ax1 and y2 = Ax2. The
+  /// default calls prod() twice; sparse matrices traverse the
+  /// elements once.
+  virtual void prodPair(const PrVec& x1, const PrVec& x2,
+			PrVec& y1, PrVec& y2) const;
   /// Virtual destructor
   virtual ~PrMatrix();
 
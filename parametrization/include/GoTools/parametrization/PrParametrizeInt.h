@@ -41,6 +41,7 @@
 #define PRPARAMETRIZEINT_H
 
 #include "GoTools/parametrization/PrOrganizedPoints.h"
+#include "GoTools/parametrization/PrPreconditioner.h"
 #include <memory>
 
 /*<PrParametrizeInt-syntax: */
@@ -70,6 +71,7 @@ protected:
 
   double                 tolerance_;
   PrParamStartVector   startvectortype_;
+  PrPrecondType        precond_type_;
 
   shared_ptr<PrOrganizedPoints> g_;
 
@@ -115,6 +117,11 @@ public:
   /// Set tolerance for Bi-CGSTAB.
   void setBiCGTolerance(double tolerance = 1.0e-6) {tolerance_ = tolerance;}
 
+  /// Set the preconditioner for Bi-CGSTAB in parametrize(). The
+  /// default is PrILU0.
+  void setPreconditioner(PrPrecondType precond_type = PrILU0)
+    {precond_type_ = precond_type;}
+
   /// Parametrize the given planar graph.
   bool parametrize();
 
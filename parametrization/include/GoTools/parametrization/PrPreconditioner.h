@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef PRPRECONDITIONER_H
+#define PRPRECONDITIONER_H
+
+#include "GoTools/parametrization/PrMatrix.h"
+#include "GoTools/parametrization/PrVec.h"
+#include <vector>
+
+/*<PrPreconditioner-syntax: */
+
+enum PrPrecondType {
+  PrNOPRECOND             = 0,
+  PrJACOBI                = 1,
+  PrILU0                  = 2
+};
+
+/** PrPreconditioner - Preconditioners for the iterative solvers PrCG
+ * and PrBiCGStab. Jacobi (diagonal) scaling works for all matrices.
+ * The incomplete LU factorization without fill-in, ILU(0), requires
+ * a PrMatSparse; for other matrices, or if a pivot vanishes,
+ * Jacobi is used instead. The triangular solves of ILU(0) are
+ * parallelized (OpenMP) by level scheduling when the dependency
+ * levels are large enough.
+ */
+class PrPreconditioner
+{
+protected:
+
+  PrPrecondType type_;
+  int n_;
+
+  // Inverse diagonal (Jacobi) or inverse pivots (ILU(0))
+  std::vector<double> invdiag_;
+
+  // The ILU(0) factors in compressed row format with sorted column
+  // indices. diag_[i] is the position of the pivot in row i
+  std::vector<int> irow_;
+  std::vector<int> jcol_;
+  std::vector<double> a_;
+  std::vector<int> diag_;
+
+  // Rows grouped in levels that can be eliminated independently,
+  // for the lower and the upper triangular solve. Only used if
+  // par_levels_ is set
+  bool par_levels_;
+  std::vector<int> lower_level_;
+  std::vector<int> lower_rows_;
+  std::vector<int> upper_level_;
+  std::vector<int> upper_rows_;
+
+  bool setupILU0(const PrMatrix& A);
+  void setupJacobi(const PrMatrix& A);
+  void makeLevels(bool lower, std::vector<int>& level_start,
+		  std::vector<int>& rows) const;
+  void solveLU(PrVec* z[], int nmb) const;
+
+public:
+  /// Constructor. No preconditioning.
+  PrPreconditioner() : type_(PrNOPRECOND), n_(0), par_levels_(false) {}
+  /// Destructor
+  ~PrPreconditioner() {}
+
+  /// Compute the preconditioner of the given kind for the matrix A.
+  void setup(const PrMatrix& A, PrPrecondType type);
+
+  /// The kind of preconditioner actually in use, which may differ from
+  /// the one asked for in setup().
+  PrPrecondType type() const {return type_;}
+
+  /// Apply the preconditioner, z = M^{-1} r.
+  void apply(const PrVec& r, PrVec& z) const;
+
+  /// Apply the preconditioner to two vectors in one sweep.
+  void apply(const PrVec& r1, const PrVec& r2, PrVec& z1, PrVec& z2) const;
+};
+
+/*>PrPreconditioner-syntax: */
+
+/*Class:PrPreconditioner
+
+Name:              PrPreconditioner
+Syntax:	           @PrPreconditioner-syntax
+Keywords:
+Description:       This class implements Jacobi and ILU(0)
+                   preconditioners for the iterative solvers PrCG and
+                   PrBiCGStab.
+Member functions:
+                   "setup(const PrMatrix& A, PrPrecondType type)" --\\
+                   Compute the preconditioner for the matrix A.
+
+                   "apply(const PrVec& r, PrVec& z)" --\\
+                   Apply the preconditioner, z = M^{-1} r.
+
+Constructors:
+Files:
+Example:
+
+See also:          PrCG, PrBiCGStab
+Developed by:      SINTEF Applied Mathematics, Oslo, Norway
+*/
+
+#endif // PRPRECONDITIONER_H
@@ -86,6 +86,9 @@ public:
     /// Element access
     const double& operator [] (int i) const {return a_[i];}
 
+    /// Exchange the elements with another vector.
+    void swap(PrVec& x) {a_.swap(x.a_);}
+
     /// Compute inner product with another vector of the same length.
     double inner(const PrVec& x);
 
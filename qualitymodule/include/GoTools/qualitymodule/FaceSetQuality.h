@@ -175,6 +175,16 @@ namespace Go
 				     std::vector<shared_ptr<ParamSurface> >& sf_knots,
 				     double tol = 1.0e-8); 
 
+	    // Perform the given tests on the attached model, each test once,
+	    // and record the time used by each test in the results. All
+	    // tests are performed if the vector is empty. Tests computed
+	    // by the same function, like identical and embedded edges, get
+	    // the time used by that function. The mini element size and the
+	    // curvature radius must be set in advance if these tests are
+	    // to be performed.
+	    void performTests(const std::vector<testSuite>& tests,
+			      double sliver_thickness);
+
 	    shared_ptr<SurfaceModel> getAssociatedSfModel()
 	      {
 		return model_;
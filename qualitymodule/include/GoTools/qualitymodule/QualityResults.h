@@ -44,6 +44,7 @@
 #include "GoTools/compositemodel/ftEdge.h"
 #include "GoTools/compositemodel/Vertex.h"
 #include <vector>
+#include <iostream>
 
 namespace Go
 {
@@ -65,9 +66,22 @@ namespace Go
     // Destructor
     ~QualityResults();
 
+    // Name of a test, as used in the report
+    static const char* testName(testSuite whichtest);
+
+    // Number of findings in a test. For tests that also report a
+    // minimum value, the minimum is not counted
+    int nmbResults(testSuite whichtest) const;
+
+    // Write one line per test with the name, whether the test is
+    // performed, the tolerance, the number of findings and the time
+    // used in seconds (-1 if not measured), separated by blanks
+    void writeReport(std::ostream& os) const;
+
   private:
     bool test_performed_[TEST_SUITE_SIZE];  
     double tolerance_used_[TEST_SUITE_SIZE];
+    double time_used_[TEST_SUITE_SIZE];
 
     // Constructor
     QualityResults();
@@ -75,6 +89,10 @@ namespace Go
     void reset(testSuite whichtest);
     void performtest(testSuite whichtest, double tol);
     bool testPerformed(testSuite whichtest, double& tol);
+    void setTimeUsed(testSuite whichtest, double time)
+    {
+      time_used_[(int)whichtest] = time;
+    }
 	    
     // Result of test for degenerate surface boundaries
     std::vector<shared_ptr<ftSurface> > deg_sfs_;
@@ -44,6 +44,7 @@
 
 #include "GoTools/utils/Point.h"
 #include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/BoxOverlaps.h"
 #include "GoTools/utils/errormacros.h"
 #include "GoTools/geometry/ClassType.h"
 #include "GoTools/geometry/CurveOnSurface.h"
@@ -173,12 +174,64 @@ public:
 
       orient_inconsist.clear();
 
+      // Pairs of faces with overlapping boxes, in the same order as a
+      // double loop over the faces would give. Only pairs where the
+      // second face is new, i.e. has index first_idx or higher, are
+      // of interest.
+      std::vector<std::pair<int,int> > face_pairs;
+      overlappingBoxPairs(boxes, tol_.neighbour, face_pairs);
+      size_t nmb_pairs = 0;
+      for (size_t kp = 0; kp < face_pairs.size(); ++kp)
+	if (face_pairs[kp].second >= first_idx)
+	  face_pairs[nmb_pairs++] = face_pairs[kp];
+      face_pairs.resize(nmb_pairs);
+
+      // Keep the pairs where at least one pair of edges overlap. Edges
+      // split during the analysis share the curve of the initial edge,
+      // and thus the box, so the initial edges suffice.
+      std::vector<std::vector<Go::BoundingBox> > edge_boxes(num_faces);
+      std::vector<bool> has_edge_boxes(num_faces, false);
+      for (size_t kp = 0; kp < face_pairs.size(); ++kp) {
+	int idx[2] = {face_pairs[kp].first, face_pairs[kp].second};
+	for (int kf = 0; kf < 2; ++kf) {
+	  if (has_edge_boxes[idx[kf]])
+	    continue;
+	  has_edge_boxes[idx[kf]] = true;
+	  std::vector<shared_ptr<edgeType> > startedges = 
+	    faces[idx[kf]]->startEdges();
+	  for (k = 0; k < int(startedges.size()); ++k) {
+	    edgeType* e = startedges[k].get();
+	    while (e) {
+	      edge_boxes[idx[kf]].push_back(e->boundingBox());
+	      e = e->next();
+	      if (e == startedges[k].get())
+		break;
+	    }
+	  }
+	}
+      }
+      std::vector<char> edge_overlap(face_pairs.size(), 0);
+      int nmb_face_pairs = (int)face_pairs.size();
+      int kp;
+#pragma omp parallel for default(none) private(kp, k, l) shared(nmb_face_pairs, face_pairs, edge_boxes, edge_overlap) schedule(dynamic, 16) if(nmb_face_pairs > 100)
+      for (kp = 0; kp < nmb_face_pairs; ++kp) {
+	const std::vector<Go::BoundingBox>& eb0 = 
+	  edge_boxes[face_pairs[kp].first];
+	const std::vector<Go::BoundingBox>& eb1 = 
+	  edge_boxes[face_pairs[kp].second];
+	for (k = 0; k < int(eb0.size()) && !edge_overlap[kp]; ++k)
+	  for (l = 0; l < int(eb1.size()); ++l)
+	    if (eb0[k].overlaps(eb1[l], tol_.neighbour)) {
+	      edge_overlap[kp] = 1;
+	      break;
+	    }
+      }
+
       std::vector<shared_ptr<edgeType> > startedges0, startedges1;
-      for (i = 0; i < num_faces - 1; ++i) {
-	int first = std::max(first_idx, i+1);
-	for (j = first; j < num_faces; ++j) {
-	  // For every combination of faces, do a boxtest.
-	  if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
+      for (kp = 0; kp < nmb_face_pairs; ++kp) {
+	i = face_pairs[kp].first;
+	j = face_pairs[kp].second;
+	  if (edge_overlap[kp]) {
 	    // We have some possible neighbourhood incidents.
 	    // Now do a box test on every combination of edges
 	    startedges0 = faces[i]->startEdges();
@@ -281,7 +334,6 @@ public:
 	      }
 	    }
 	  }
-	}
       }
     }
 
@@ -43,6 +43,7 @@
 #include "GoTools/topology/tpTolerances.h"
 #include "GoTools/utils/Point.h"
 #include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/BoxOverlaps.h"
 #include "GoTools/utils/errormacros.h"
 #include "GoTools/geometry/LineCloud.h"
 #include "GoTools/geometry/CurveOnSurface.h"
@@ -227,91 +228,93 @@ public:
 	    boxes.push_back(faces[i]->boundingBox());
 	}
 
+	// The pairs of faces with overlapping boxes, ordered as in a
+	// double loop over the faces
+	std::vector<std::pair<int,int> > face_pairs;
+	overlappingBoxPairs(boxes, tol_.neighbour, face_pairs);
+
 	std::vector<shared_ptr<edgeType> > startedges0, startedges1;
-	for (i = 0; i < num_faces - 1; ++i) {
-	    for (j = i + 1; j < num_faces; ++j) {
-		// For every combination of faces, do a boxtest.
-		if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
-		    // We have some possible neighbourhood incidents.
-		    // Now do a box test on every combination of edges
-		    startedges0 = faces[i]->startEdges();
-		    startedges1 = faces[j]->startEdges();
-		    // Testing all loops in one surface against
-		    // all loops in the other.
-		    for (k = 0; k < int(startedges0.size()); ++k) {
-			for (l = 0; l < int(startedges1.size()); ++l) {
-			    edgeType* s0 = startedges0[k].get();
-			    edgeType* s1 = startedges1[l].get();
-			    if (s0 ==0 || s1 == 0) break;
-			    edgeType* e[2];
-			    e[0] = s0;
-			    e[1] = s1;
-			    edgeType* en[2];
-			    bool finished = false;
-			    while(!finished) {
-				en[0] = e[0]->next();
-				en[1] = e[1]->next();
+	for (size_t kp = 0; kp < face_pairs.size(); ++kp) {
+	    i = face_pairs[kp].first;
+	    j = face_pairs[kp].second;
+	    // We have some possible neighbourhood incidents.
+	    // Now do a box test on every combination of edges
+	    startedges0 = faces[i]->startEdges();
+	    startedges1 = faces[j]->startEdges();
+	    // Testing all loops in one surface against
+	    // all loops in the other.
+	    for (k = 0; k < int(startedges0.size()); ++k) {
+		for (l = 0; l < int(startedges1.size()); ++l) {
+		    edgeType* s0 = startedges0[k].get();
+		    edgeType* s1 = startedges1[l].get();
+		    if (s0 ==0 || s1 == 0) break;
+		    edgeType* e[2];
+		    e[0] = s0;
+		    e[1] = s1;
+		    edgeType* en[2];
+		    bool finished = false;
+		    while(!finished) {
+			en[0] = e[0]->next();
+			en[1] = e[1]->next();
 #ifdef TOPOLOGY_DEBUG
-				std::ofstream debug("data/debug.g2");
-				for (int ki = 0; ki < 2; ++ki) {
-				    e[ki]->face()->surface()->writeStandardHeader(debug);
-				    e[ki]->face()->surface()->write(debug);
-				    std::vector<double> pts(12);
-				    Go::Point from = e[ki]->point(e[ki]->tMin());
-				    double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
-				    Go::Point mid = e[ki]->point(tmid);
-				    Go::Point to = e[ki]->point(e[ki]->tMax());
-				    std::copy(from.begin(), from.end(), pts.begin());
-				    std::copy(mid.begin(), mid.end(), pts.begin() + 3);
-				    std::copy(mid.begin(), mid.end(), pts.begin() + 6);
-				    std::copy(to.begin(), to.end(), pts.begin() + 9);
-				    Go::LineCloud lc(pts.begin(), 2);
-				    lc.writeStandardHeader(debug);
-				    lc.write(debug);
-				}
+			std::ofstream debug("data/debug.g2");
+			for (int ki = 0; ki < 2; ++ki) {
+			    e[ki]->face()->surface()->writeStandardHeader(debug);
+			    e[ki]->face()->surface()->write(debug);
+			    std::vector<double> pts(12);
+			    Go::Point from = e[ki]->point(e[ki]->tMin());
+			    double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
+			    Go::Point mid = e[ki]->point(tmid);
+			    Go::Point to = e[ki]->point(e[ki]->tMax());
+			    std::copy(from.begin(), from.end(), pts.begin());
+			    std::copy(mid.begin(), mid.end(), pts.begin() + 3);
+			    std::copy(mid.begin(), mid.end(), pts.begin() + 6);
+			    std::copy(to.begin(), to.end(), pts.begin() + 9);
+			    Go::LineCloud lc(pts.begin(), 2);
+			    lc.writeStandardHeader(debug);
+			    lc.write(debug);
+			}
 #endif // TOPOLOGY_DEBUG
-				if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
-								 tol_.neighbour)) {
-				    // We found an edge overlap. Possible incident.
-				    int incident_occurred = 
-					testEdges(e);
-				    if (incident_occurred) {
-					// We skip the rest of this subloop (looping
-					// over edges e[1] in face faces[j]) by
-					// making en[1] so that e[0] will be
-					// incremented.
-					// If e[0] was split w/t-value higher than
-					// start value, do not forget first part of
-					// edge.
-
-					if (incident_occurred >= 2)
-					{
-					    // Inconsistence in face orientation
-					    // Remember incident
-					    // Check if it has occured before
-					    size_t kr;
-					    for (kr=0; kr<orientation_inconsist_.size(); ++kr)
-						if ((orientation_inconsist_[kr].first == faces[i].get() &&
-						     orientation_inconsist_[kr].second == faces[j].get()) ||
-						    (orientation_inconsist_[kr].first == faces[j].get() &&
-						     orientation_inconsist_[kr].second == faces[i].get()))
-						    break;
-
-					    if (kr == orientation_inconsist_.size())
-					      orientation_inconsist_.push_back(std::make_pair(faces[i].get(),
-											   faces[j].get()));
-					}
-				    }
-				}
-				// Pick next edges, check if we're done
-				e[1] = en[1];
-				if (e[1] == s1) {
-				    e[0] = en[0];
-				    if (e[0] == s0)
-					finished = true;
+			if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
+							 tol_.neighbour)) {
+			    // We found an edge overlap. Possible incident.
+			    int incident_occurred = 
+				testEdges(e);
+			    if (incident_occurred) {
+				// We skip the rest of this subloop (looping
+				// over edges e[1] in face faces[j]) by
+				// making en[1] so that e[0] will be
+				// incremented.
+				// If e[0] was split w/t-value higher than
+				// start value, do not forget first part of
+				// edge.
+
+				if (incident_occurred >= 2)
+				{
+				    // Inconsistence in face orientation
+				    // Remember incident
+				    // Check if it has occured before
+				    size_t kr;
+				    for (kr=0; kr<orientation_inconsist_.size(); ++kr)
+					if ((orientation_inconsist_[kr].first == faces[i].get() &&
+					     orientation_inconsist_[kr].second == faces[j].get()) ||
+					    (orientation_inconsist_[kr].first == faces[j].get() &&
+					     orientation_inconsist_[kr].second == faces[i].get()))
+					    break;
+
+				    if (kr == orientation_inconsist_.size())
+				      orientation_inconsist_.push_back(std::make_pair(faces[i].get(),
+										   faces[j].get()));
 				}
 			    }
 			}
+			// Pick next edges, check if we're done
+			e[1] = en[1];
+			if (e[1] == s1) {
+			    e[0] = en[0];
+			    if (e[0] == s0)
+				finished = true;
+			}
 		    }
 		}
 	    }
@@ -43,6 +43,7 @@
 
 
 #include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/creators/SparseMatrix.h"
 
 #include <memory>
 #include <vector>
@@ -180,7 +181,7 @@ namespace Go
 
     /// Storage of the equation system.
     int nmb_free_;     // Number of free variables in equation system
-    std::vector<double> gmat_;       // Matrix at left side of equation system
+    SparseMatrix gmat_;              // Matrix at left side of equation system
     std::vector<double> gright_;     // Right side of equation system
     std::vector<int> pivot_;         // Array giving the position of the free coefficients
 